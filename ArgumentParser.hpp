@@ -5,12 +5,47 @@
 #include <utility>
 #include <iomanip>
 #include <sstream>
-#include <cstring> // for strlen
+#include <fstream>
+#include <optional>
+#include <cstdint>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <mutex>
+#include <condition_variable>
+#include <system_error>
+#include <queue>
+#include <numeric>
+#include <cstdlib>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#define ARGPAR_POSIX
+extern char** environ;
+#endif
+
+#if defined(__SSE2__) && (defined(__GNUC__) || defined(__clang__))
+#include <emmintrin.h>
+#define ARGPAR_SSE2_TOKENIZER
+#endif
+#include <charconv>
+#include <cstring> // for memcpy
+#include <cctype>
+#include <string_view>
+#include <unordered_map>
 #include <string>
 #include <vector>
+#include <typeinfo>
 #include <limits>
+#include <memory>
+#include <array>
 #include <tuple>
 #include <map>
+#include <deque>
 
 #define CalleeLengthBeforeDescription 22
 
@@ -42,31 +77,93 @@ public:
 	const std::vector<std::string> missingArguments() const {return _missingArguments;}
 };
 
+class ConstraintViolation : public std::exception {
+	const std::string _message;
+	const std::string _Constraint;
+	const std::vector<std::string> _Arguments;
+
+public:
+	ConstraintViolation(std::string msg, std::string Constraint, std::vector<std::string> Arguments) 
+		: _message(msg), _Constraint(Constraint), _Arguments(Arguments) {}
+	
+	const char* what() const noexcept override { return _message.c_str(); }
+	// The violated constraint, e.g. "mutually exclusive: -a, -b"
+	const std::string Constraint() const {return _Constraint;}
+	// The arguments causing the violation, the passed arguments that conflict or the missing ones
+	const std::vector<std::string> Arguments() const {return _Arguments;}
+};
+
+// Thrown for a passed argument or subcommand that does not exist, an invalid_argument like parsing threw before
+class UnknownArgument : public std::invalid_argument {
+	const std::string _Callee;
+	const std::vector<std::string> _Suggestions;
+
+public:
+	UnknownArgument(const std::string& msg, std::string Callee, std::vector<std::string> Suggestions) 
+		: std::invalid_argument(msg), _Callee(Callee), _Suggestions(Suggestions) {}
+
+	// The unknown argument or subcommand as passed
+	const std::string Callee() const {return _Callee;}
+	// The closest existing callees or subcommands, closest first, empty if none is close
+	const std::vector<std::string> Suggestions() const {return _Suggestions;}
+};
+
+// Kinds of errors parsing can fail with, see ParseError
+enum class ParseErrc : std::uint8_t {
+	None,
+	UnknownArgument,		// UnknownArgument, a passed callee or compound character does not exist
+	UnknownSubcommand,		// UnknownArgument, the first operand is not a subcommand
+	AmbiguousArgument,		// invalid_argument, an abbreviation matches callees of different arguments
+	MissingParameters,		// out_of_range, an argument got too few parameters and has no implicit or default values
+	ValidatorFailed,		// ValidatorException
+	MissingRequired,		// MissingRequiredParameter
+	ConstraintViolated		// ConstraintViolation
+};
+
 
 //?==== most generic stringToType() you'll find out there ====?//
 
+/**
+ * @brief Gets the name of a type at compile time from the signature of this function
+ * @return std::string_view The name, viewing the static signature string
+ */
 template <typename T>
-std::string get_type_name(){
+constexpr std::string_view type_name(){
 #if defined(__clang__)
-	const std::string prefix = "[T = ";
-	constexpr auto suffix = "]";
-	const std::string function = __PRETTY_FUNCTION__;
+	constexpr std::string_view prefix = "[T = ";
+	constexpr std::string_view suffix = "]";
+	const std::string_view function = __PRETTY_FUNCTION__;
 #elif defined(__GNUC__)
-	const std::string prefix = "with T = ";
-	constexpr auto suffix = "; ";
-	const std::string function = __PRETTY_FUNCTION__;
-#elif defined(__MSC_VER)
-	const std::string prefix = "get_type_name<";
-	constexpr auto suffix = ">(void)";
-	const std::string function = __FUNCSIG__;
-#else
-	return typeid(T).name; // return a normally mangled type if compiler does not support demangling
+	constexpr std::string_view prefix = "with T = ";
+	constexpr std::string_view suffix = "; ";
+	const std::string_view function = __PRETTY_FUNCTION__;
+#elif defined(_MSC_VER)
+	constexpr std::string_view prefix = "type_name<";
+	constexpr std::string_view suffix = ">(void)";
+	const std::string_view function = __FUNCSIG__;
+#else // the signature of the function is not available
+	constexpr std::string_view prefix = "[T = ";
+	constexpr std::string_view suffix = "]";
+	const std::string_view function = "[T = unknown]";
 #endif
-	
 	const auto start = function.find(prefix) + prefix.size();
-	const auto end = function.find(suffix);
-	const auto size = end - start;
-	return function.substr(start, size);
+	auto end = function.find(suffix, start);
+	if(end == std::string_view::npos) // gcc omits the suffix if the signature has no other template names
+		end = function.rfind(']');
+	return function.substr(start, end - start);
+}
+
+// Gets the name of a type as string, see type_name
+template <typename T>
+std::string get_type_name(){
+	return std::string(type_name<T>());
+}
+
+// Caches the type name so error paths do not rebuild it every time
+template <typename T>
+const std::string& cached_type_name(){
+	static const std::string name = get_type_name<T>();
+	return name;
 }
 
 // checks if a type T has the >> operator, this works somehow? source: https://stackoverflow.com/a/18603716
@@ -75,649 +172,6364 @@ std::true_type 		supports_stream_conversion_test(const T&);
 std::false_type 	supports_stream_conversion_test(...);
 template<class T> using supports_stream_conversion = decltype(supports_stream_conversion_test(std::declval<T>()));
 
+//?==== Non allocating conversions for arithmetic types ====?//
+
+template<typename T>
+using is_char_type = std::integral_constant<bool, std::is_same<T, char>::value || std::is_same<T, signed char>::value || std::is_same<T, unsigned char>::value>;
+
+template<typename T>
+using is_integer_type = std::integral_constant<bool, std::is_integral<T>::value && !is_char_type<T>::value && !std::is_same<T, bool>::value>;
+
+// Floating point from_chars is only available if the standard library fully implements charconv
+#if defined(__cpp_lib_to_chars)
+template<typename T>
+using is_fast_floating_type = std::is_floating_point<T>;
+#else
+template<typename T>
+using is_fast_floating_type = std::false_type;
+#endif
+
+// checks if a type T can be converted by FastConvert
+template<typename T>
+using supports_fast_conversion = std::integral_constant<bool, is_char_type<T>::value || is_integer_type<T>::value 
+	|| is_fast_floating_type<T>::value || std::is_same<T, bool>::value || std::is_same<T, std::string>::value || std::is_same<T, std::string_view>::value>;
+
+// Strips a leading + as operator>> accepts it but from_chars does not, a following sign is not allowed
+inline bool StripPlusSign(std::string_view& s) noexcept {
+	if(!s.empty() && s[0] == '+'){
+		s.remove_prefix(1);
+		return !s.empty() && s[0] != '-' && s[0] != '+';
+	}
+	return true;
+}
+
 /**
- * @brief Converts a string to a type T
- * Only converts if the class has a stream >> operator implementation. Otherwise throws an invalid argument exception
- * @tparam T type to conver to
- * @param s the string to convert to T
- * @return const T the converted value
- * @throws invalid_argument exception if the conversion fails. This can occur if the string is empty
+ * @brief Converts a string to an integer, the whole string has to be a valid base 10 integer that fits in T
+ * @return true if the conversion succeeded
  */
 template<typename T>
-const typename std::enable_if<supports_stream_conversion<T>::value, T>::type ToType(const std::string& s ) {
-	if(s.empty()){
-		throw std::invalid_argument("Conversion string is empty");
-	}
-	std::stringstream convert(s);
-	T value;
-	convert >> value;
-	if(convert.fail()){
-		convert.clear();
-		std::string dummy;
-		convert >> dummy;
-		const auto conc = "Conversion from \"" + s + "\" to " + get_type_name<T>() + " failed";
-		throw std::invalid_argument(conc);
-	}
-	return value;
+typename std::enable_if<is_integer_type<T>::value, bool>::type FastConvert(std::string_view s, T& value) noexcept {
+	if(!StripPlusSign(s))
+		return false;
+	const auto result = std::from_chars(s.data(), s.data() + s.size(), value);
+	return result.ec == std::errc() && result.ptr == s.data() + s.size();
 }
 
-// SFINAE, catch class with no >> operator defined, throw error
+#if defined(__cpp_lib_to_chars)
+/**
+ * @brief Converts a string to a floating point value, the whole string has to be a valid number
+ * @return true if the conversion succeeded
+ */
 template<typename T>
-const typename std::enable_if<!supports_stream_conversion<T>::value, T>::type ToType(const std::string& s) {
-	// give a runtime error that the parameter string can not implicitly be converted to the given type T class
-	// Assert is not used as the type of T is not properly passed
-	throw std::invalid_argument("\n\nConversion from string to "+ get_type_name<T>()+" is not supported.\n"
-						"Either add a custom parser function or extend istream with\n"
-						"std::istream& operator>>(std::istream&, "+ get_type_name<T>()+"&){}\n");
-	return T();
+typename std::enable_if<std::is_floating_point<T>::value, bool>::type FastConvert(std::string_view s, T& value) noexcept {
+	if(!StripPlusSign(s))
+		return false;
+	const auto result = std::from_chars(s.data(), s.data() + s.size(), value);
+	return result.ec == std::errc() && result.ptr == s.data() + s.size();
 }
+#endif
 
-class ArgumentParser;
+/**
+ * @brief Converts a string of exactly one character to a character type
+ * @return true if the conversion succeeded
+ */
+template<typename T>
+typename std::enable_if<is_char_type<T>::value, bool>::type FastConvert(std::string_view s, T& value) noexcept {
+	if(s.size() != 1)
+		return false;
+	value = static_cast<T>(s[0]);
+	return true;
+}
 
-class Argument {
-	friend class ArgumentParser;
+/**
+ * @brief Converts 0, 1, true or false to a boolean
+ * @return true if the conversion succeeded
+ */
+inline bool FastConvert(std::string_view s, bool& value) noexcept {
+	if(s == "1" || s == "true")
+		value = true;
+	else if(s == "0" || s == "false")
+		value = false;
+	else
+		return false;
+	return true;
+}
 
-	
-	bool required = false;
-	bool has_implicitValues = false;
-	bool has_defaultValues = false;
-	bool is_flag = false;
-	bool is_used = false;
-	bool parseAlways = false;
-	bool needs_parameters = true;
+// Strings are copied as a whole, operator>> would stop at the first whitespace
+inline bool FastConvert(std::string_view s, std::string& value){
+	value.assign(s.data(), s.size());
+	return true;
+}
 
-	std::size_t _priority = 0;
+// Views keep pointing into the parsed string
+inline bool FastConvert(std::string_view s, std::string_view& value) noexcept {
+	value = s;
+	return true;
+}
 
-	std::size_t _paramcount = 0;
+//?==== Converter registry ====?//
 
-	std::vector<std::string> Callees;
-	std::string helpString = "Look at me, I forgot to add a help string!";
+/**
+ * @brief Converts parameter strings to T, specialize it to register a conversion for a type
+ * A converter provides static bool Convert(std::string_view, T&), which returns false if the string is not a valid T. 
+ * It may provide static void Format(const T&, std::string&), used by DefaultValue and ImplicitValue instead of operator<<, 
+ * and static constexpr std::string_view Name(), the parameter name shown in help, a Name returning std::string is stored when the argument is added. ToType uses a registered converter over FastConvert and operator>>.
+ * @code
+ * template<> struct ArgPar::Converter<Point> {
+ * 	static bool Convert(std::string_view s, Point& value) noexcept;
+ * };
+ * @endcode
+ */
+template<typename T, typename = void>
+struct Converter {};
 
-	std::vector<std::string> _ParamValues;
-	std::vector<std::string> _ParamImplicitValues;
-	std::vector<std::string> _ParamNames;
+// checks if a Converter is registered for a type T
+template<typename T, typename = void>
+struct has_converter : std::false_type {};
+template<typename T>
+struct has_converter<T, std::void_t<decltype(Converter<T>::Convert(std::declval<std::string_view>(), std::declval<T&>()))>> : std::true_type {};
 
-	std::function<void(const std::vector<std::string>&)> _f_ArgumentAction = nullptr;
-	std::function<std::size_t(const std::vector<std::string>&)> _f_ParameterParserValidator = nullptr;
-	// Gets the type of the ParamTypes parameter pack at index I
-	template<std::size_t I, typename ...ParamTypes>
-	using TupleTypeAt = typename std::tuple_element<I, std::tuple<ParamTypes...>>::type;
-	
-	// Formats parameter names and default values if present
-	void FormatParameters(std::stringstream& ss) const{
-		if(is_flag)
-			return;
-		for(std::size_t i = 0; i < _paramcount; i++){
-			ss << "[" << _ParamNames[i];
-			if(has_implicitValues){
-				std::string implicitStringValue = _ParamImplicitValues[i];
-				// remove trailing 0s
-				if(implicitStringValue.find('.') != std::string::npos){
-					implicitStringValue = implicitStringValue.substr(0, implicitStringValue.find_last_not_of('0')+1);
-					if(implicitStringValue.find('.') == implicitStringValue.size()-1)
-						implicitStringValue = implicitStringValue.substr(0, implicitStringValue.size()-1);
-				}
-				ss << ": " << implicitStringValue;
-			}
-			ss << "] ";
-		}
-		if(has_defaultValues){
-			ss << " default: ";
-			for(std::size_t i = 0; i < _paramcount; i++)
-				ss << _ParamNames[i] << "(" << _ParamValues[i] << ") ";
-		}
-	}
+template<typename T, typename = void>
+struct has_converter_format : std::false_type {};
+template<typename T>
+struct has_converter_format<T, std::void_t<decltype(Converter<T>::Format(std::declval<const T&>(), std::declval<std::string&>()))>> : std::true_type {};
 
-	// Formats the Callee's
-	std::string GetCalleeFormatted() const {
-		std::string calleeFormatted;
-		for(std::size_t i = 0; i < Callees.size() - 1; i++){
-			calleeFormatted += Callees[i] + ", ";
-		}
-		calleeFormatted += Callees.back();
-		return calleeFormatted;
-	}
+template<typename T, typename = void>
+struct has_converter_name : std::false_type {};
+template<typename T>
+struct has_converter_name<T, std::void_t<decltype(Converter<T>::Name())>> : std::true_type {};
 
-	//?==== Argument parser logic ====?//
-	/**
-	 * @brief Parses parameters given to the argument
-	 * First sets up a buffer containing the values based on implicit parameter values or default values, then performs a validator if set and then calls the custom function set by .Action() if set.
-	 * Implicit values are used over default values if not all parameter values are specified.
-	 * @param Parameters The list of parameters passed through CLI
-	 * @throws out_of_range exception if not enough parameters are passed and no implicit or default values are specified.
-	 * @throws ValidatorException exception if the passed parameter values do not pass the custom validator function. Only applies if validator function is specified.
-	 */
-	void _ParseArg(std::vector<std::string>& Parameters){
-		if(!needs_parameters)
-			_f_ArgumentAction({}); // optimatisation for information arguments
-		// Set up vector containing the correct parameter values
-		std::vector<std::string> tempParamValues(_ParamValues.size());
-		std::copy(_ParamValues.begin(), _ParamValues.end(), tempParamValues.begin());
-		is_used = true;
-		// If there are implicit values and no parameters given, use implicit values
-		if(has_implicitValues && Parameters.size() == 0)
-			std::copy(_ParamImplicitValues.begin(), _ParamImplicitValues.end(), tempParamValues.begin());
-		else{
-			auto ParamCopyIt = std::copy(Parameters.begin(), Parameters.end(), tempParamValues.begin());
-			if(ParamCopyIt != tempParamValues.end()){ // Not all parameter values were passed
-				std::size_t CopiedCount = ParamCopyIt - tempParamValues.begin();
-				std::cout << CopiedCount << std::endl;
-				if(has_implicitValues) // we have implicit values through!
-					std::copy(_ParamImplicitValues.begin() + CopiedCount, _ParamImplicitValues.end(), ParamCopyIt);
-				else if(has_defaultValues) // or we have default values though!
-					std::copy(_ParamValues.begin() + CopiedCount, _ParamValues.end(), ParamCopyIt);
-				else{ // no default values and not enough parameters. Problem!
-					std::stringstream exception_error;
-					exception_error << "Not enough parameters for argument: " << Callees[0] << " default usage: \n\t";
-					exception_error << GetCalleeFormatted() << " ";
-					if(!has_implicitValues)	// don't print default values if there is an implicit value
-						FormatParameters(exception_error);
-					else
-						exception_error << std::endl;
-					throw std::out_of_range(exception_error.str());
-				}
-			}
-		}
-		// If there is a validator, execute validator
-		if(_f_ParameterParserValidator){
-			std::size_t pos = _f_ParameterParserValidator(tempParamValues);
-			if(pos)
-				throw ValidatorException(("Validator for argument: " + Callees[0] + " failed at position " + std::to_string(pos)), Callees[0], pos);
-		}
+// checks if a type T can be converted from a string at all, by a Converter, FastConvert or operator>>
+template<typename T>
+using supports_conversion = std::integral_constant<bool, has_converter<T>::value || supports_fast_conversion<T>::value || supports_stream_conversion<T>::value>;
 
-		// If there is a custom parser, execute that instead
-		if(needs_parameters && _f_ArgumentAction)
-			_f_ArgumentAction(tempParamValues);
-		// Copy the values if everything went well
-		std::copy(tempParamValues.begin(), tempParamValues.end(), _ParamValues.begin());
-		
-	}
+// Converts a string without allocating or throwing through the registered Converter or FastConvert
+template<typename T>
+bool ConvertParameter(std::string_view s, T& value){
+	if constexpr(has_converter<T>::value)
+		return Converter<T>::Convert(s, value);
+	else
+		return FastConvert(s, value);
+}
 
-	// Init parameter names based on variadic list, this creates default param names
-	template<std::size_t I = 0, typename ...ParamTypes>
-	inline typename std::enable_if<I  < sizeof...(ParamTypes), void>::type InitParamNamesDefault(){
-		_ParamNames[I] = get_type_name<TupleTypeAt<I, ParamTypes...>>();
-		InitParamNamesDefault<I+1, ParamTypes...>();
-	}
-	// SFINAE
-	template<std::size_t I = 0, typename ...ParamTypes>
-	inline typename std::enable_if<I == sizeof...(ParamTypes), void>::type InitParamNamesDefault(){}
+// checks if a value of type T can be formatted as parameter string, by a Converter or operator<<
+template<typename T, typename = void>
+struct supports_parameter_format : has_converter_format<T> {};
+template<typename T>
+struct supports_parameter_format<T, std::void_t<decltype(std::declval<std::ostream&>() << std::declval<const T&>())>> : std::true_type {};
 
-	// Init implicit values based on variadic list
-	template<std::size_t I = 0, typename ...ParamTypes>
-	typename std::enable_if<I  < sizeof...(ParamTypes), void>::type implicit_value(std::tuple<ParamTypes...> t){
+/**
+ * @brief Formats a value as parameter string through the registered Converter, to_chars for arithmetic types or operator<<
+ * Strings are copied and arithmetic values are formatted as operator<< would without constructing a stream.
+ * @return false if the value can not be formatted
+ */
+template<typename T>
+bool FormatParameter(const T& value, std::string& Out){
+	if constexpr(has_converter_format<T>::value){
+		Out.clear();
+		Converter<T>::Format(value, Out);
+		return true;
+	}
+	else if constexpr(std::is_convertible<const T&, std::string_view>::value){
+		if constexpr(std::is_pointer<T>::value)
+			if(!value)
+				return false;
+		Out.assign(std::string_view(value));
+		return true;
+	}
+	else if constexpr(std::is_same<T, bool>::value){
+		Out.assign(value ? "1" : "0");
+		return true;
+	}
+	else if constexpr(is_char_type<T>::value){
+		Out.assign(1, static_cast<char>(value));
+		return true;
+	}
+	else if constexpr(is_integer_type<T>::value || is_fast_floating_type<T>::value){
+		char Buffer[64];
+		std::to_chars_result Result;
+		if constexpr(std::is_floating_point<T>::value)
+			Result = std::to_chars(Buffer, Buffer + sizeof(Buffer), value, std::chars_format::general, 6); // the default precision of streams
+		else
+			Result = std::to_chars(Buffer, Buffer + sizeof(Buffer), value);
+		if(Result.ec != std::errc())
+			return false;
+		Out.assign(Buffer, Result.ptr);
+		return true;
+	}
+	else{
 		std::stringstream ss;
-		ss << std::get<I>(t);
+		ss << value;
 		if(ss.fail() | ss.bad())
-			throw std::invalid_argument("Implicit value for argument " + Callees[0] + " at position " + std::to_string(I) + " is invalid, "\
-										"Conversion from " + get_type_name<TupleTypeAt<I, ParamTypes...>>() + " to string failed.");
-		_ParamImplicitValues[I] = ss.str();
-		implicit_value<I+1, ParamTypes...>(t);
+			return false;
+		Out = ss.str();
+		return true;
 	}
-	//SFINAE
-	template<std::size_t I = 0, typename ...ParamTypes>
-	typename std::enable_if<I == sizeof...(ParamTypes), void>::type implicit_value(std::tuple<ParamTypes...> t){(void)(t);}
+}
 
-	// Init default values based on variadic list
-	template<std::size_t I = 0, typename ...ParamTypes>
-	typename std::enable_if<I  < sizeof...(ParamTypes), void>::type default_value(std::tuple<ParamTypes...> t){
-		std::stringstream ss;
-		ss << std::get<I>(t);
-		if(ss.fail() | ss.bad())
-			throw std::invalid_argument("Default value for argument " + Callees[0] + " at position " + std::to_string(I) + " is invalid, "\
-										"Conversion from " + get_type_name<TupleTypeAt<I, ParamTypes...>>() + " to string failed.");
-		_ParamValues[I] = ss.str();
-		default_value<I+1, ParamTypes...>(t);
+// Gets the name of a parameter of type T shown in help, the Converter name or the type name
+template<typename T>
+constexpr decltype(auto) ParameterTypeName(){
+	if constexpr(has_converter_name<T>::value)
+		return Converter<T>::Name();
+	else
+		return type_name<T>();
+}
+
+// A decimal number with an optional fraction, Integer + Fraction / Scale
+struct DecimalNumber {
+	std::uint64_t Integer = 0;
+	std::uint64_t Fraction = 0;
+	std::uint64_t Scale = 1;
+};
+
+/**
+ * @brief Reads a decimal number as 12 or 1.5 from the front of s, digits beyond the 9th of the fraction are ignored
+ * @return true if s starts with a number that fits in 64 bits, s is advanced past it
+ */
+inline bool ReadDecimal(std::string_view& s, DecimalNumber& Number) noexcept {
+	std::size_t i = 0;
+	Number = DecimalNumber();
+	for(; i < s.size() && s[i] >= '0' && s[i] <= '9'; i++){
+		const std::uint64_t Digit = static_cast<std::uint64_t>(s[i] - '0');
+		if(Number.Integer > (std::numeric_limits<std::uint64_t>::max() - Digit) / 10)
+			return false;
+		Number.Integer = Number.Integer * 10 + Digit;
 	}
-	//SFINAE end condition
-	template<std::size_t I = 0, typename ...ParamTypes>
-	typename std::enable_if<I == sizeof...(ParamTypes), void>::type default_value(std::tuple<ParamTypes...> t){(void)(t);}
+	const std::size_t IntegerDigits = i;
+	std::size_t FractionDigits = 0;
+	if(i < s.size() && s[i] == '.'){
+		for(i++; i < s.size() && s[i] >= '0' && s[i] <= '9'; i++, FractionDigits++){
+			if(Number.Scale < 1000000000){
+				Number.Fraction = Number.Fraction * 10 + static_cast<std::uint64_t>(s[i] - '0');
+				Number.Scale *= 10;
+			}
+		}
+		if(!FractionDigits)
+			return false;
+	}
+	if(!IntegerDigits && !FractionDigits)
+		return false;
+	s.remove_prefix(i);
+	return true;
+}
 
-	// Init parameter names based on variadic list
-	template<std::size_t I = 0, typename ...ParamTypes>
-	typename std::enable_if<I  < sizeof...(ParamTypes), void>::type parameter_name(std::tuple<ParamTypes...> t){
-		_ParamNames[I] = std::get<I>(t);
-		parameter_name<I+1, ParamTypes...>(t);
+// Multiplies a decimal number by a unit, the fractional part of the result is truncated. Returns false on overflow
+inline bool ScaleDecimal(const DecimalNumber& Number, std::uint64_t Unit, std::uint64_t& Result) noexcept {
+	constexpr std::uint64_t Max = std::numeric_limits<std::uint64_t>::max();
+	if(Number.Integer && Unit > Max / Number.Integer)
+		return false;
+	// Fraction * Unit / Scale split as Fraction * (Unit / Scale) + Fraction * (Unit % Scale) / Scale, both Fraction and Scale are at most 10^9
+	const std::uint64_t Whole = Unit / Number.Scale;
+	if(Number.Fraction && Whole > Max / Number.Fraction)
+		return false;
+	const std::uint64_t FractionPart = Number.Fraction * Whole + Number.Fraction * (Unit % Number.Scale) / Number.Scale;
+	if(FractionPart > Max - Number.Integer * Unit)
+		return false;
+	Result = Number.Integer * Unit + FractionPart;
+	return true;
+}
+
+// Compares ASCII strings ignoring case
+constexpr bool EqualsIgnoreCase(std::string_view A, std::string_view B) noexcept {
+	if(A.size() != B.size())
+		return false;
+	for(std::size_t i = 0; i < A.size(); i++){
+		const char a = A[i] >= 'A' && A[i] <= 'Z' ? static_cast<char>(A[i] - 'A' + 'a') : A[i];
+		const char b = B[i] >= 'A' && B[i] <= 'Z' ? static_cast<char>(B[i] - 'A' + 'a') : B[i];
+		if(a != b)
+			return false;
+	}
+	return true;
+}
+
+/**
+ * @brief A name of an enum value, see EnumTable
+ */
+template<typename E>
+struct EnumName {
+	std::string_view Name;
+	E Value;
+};
+
+/**
+ * @brief A compile time table of the names of the values of an enum, names are looked up through a perfect hash
+ * The table is built by hash and displace: names are grouped in buckets by their hash, and starting with the largest bucket 
+ * every bucket gets the displacement that moves all its names into free slots. A lookup hashes the name once and compares a single candidate.
+ * Duplicate names fail to compile.
+ */
+template<typename E, std::size_t N>
+class EnumTable {
+	static_assert(N > 0, "An EnumTable needs at least one name");
+
+	static constexpr std::size_t SlotBits = [](){
+		std::size_t Bits = 1;
+		while((std::size_t(1) << Bits) < 2 * N)
+			Bits++;
+		return Bits;
+	}();
+	static constexpr std::size_t Slots = std::size_t(1) << SlotBits;
+
+	std::array<EnumName<E>, N> Names{};
+	std::array<std::uint32_t, Slots> Displacements{}; // of every bucket, 0 for empty buckets
+	std::array<std::uint32_t, Slots> Entries{}; // name index + 1 of every slot, 0 for free slots
+
+	static constexpr std::uint64_t Hash(std::string_view Name) noexcept {
+		std::uint64_t Hash = 14695981039346656037ull; // FNV-1a
+		for(char c : Name)
+			Hash = (Hash ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+		return Hash;
+	}
+	static constexpr std::size_t Bucket(std::uint64_t Hash) noexcept {return static_cast<std::size_t>(Hash & (Slots - 1));}
+	static constexpr std::size_t Slot(std::uint64_t Hash, std::uint32_t Displacement) noexcept {
+		return static_cast<std::size_t>(((Hash ^ (Displacement * 0x9E3779B97F4A7C15ull)) * 0xFF51AFD7ED558CCDull) >> (64 - SlotBits));
 	}
-	//SFINAE
-	template<std::size_t I = 0, typename ...ParamTypes>
-	typename std::enable_if<I == sizeof...(ParamTypes), void>::type parameter_name(std::tuple<ParamTypes...> t){(void)(t);}
 
 public:
-	
-	/**
-	 * @brief Construct a new Argument object
-	 * 
-	 * @param paramcount The amount of parameters this argument will use
-	 * @param ArgName First Possible Argument Callee, Single character prefix with -, multi character prefix with --
-	 * @param ArgName2 Second Possible Argument Callee, Single character prefix with -, multi character prefix with --
-	 */
-	Argument(std::size_t paramcount, std::string ArgName, std::string ArgName2 = "") 
-		: _paramcount(paramcount), Callees(1), _ParamValues(paramcount), 
-		  _ParamImplicitValues(paramcount), _ParamNames(paramcount){
-		Callees[0] = ArgName;
-		if(!ArgName2.empty())
-			Callees.push_back(ArgName2);
+	constexpr EnumTable(const EnumName<E> (&Init)[N]) {
+		std::array<std::size_t, Slots> BucketSizes{};
+		for(std::size_t i = 0; i < N; i++){
+			for(std::size_t j = 0; j < i; j++)
+				if(Init[j].Name == Init[i].Name)
+					throw std::logic_error("Duplicate name in EnumTable");
+			Names[i] = Init[i];
+			BucketSizes[Bucket(Hash(Names[i].Name))]++;
+		}
+		for(std::size_t Size = N; Size > 0; Size--){
+			for(std::size_t b = 0; b < Slots; b++){
+				if(BucketSizes[b] != Size)
+					continue;
+				for(std::uint32_t Displacement = 1;; Displacement++){
+					std::array<std::size_t, N> Taken{};
+					std::size_t Placed = 0;
+					for(std::size_t i = 0; i < N && Placed < Size; i++){
+						if(Bucket(Hash(Names[i].Name)) != b)
+							continue;
+						const std::size_t s = Slot(Hash(Names[i].Name), Displacement);
+						bool Free = !Entries[s];
+						for(std::size_t t = 0; t < Placed; t++)
+							Free = Free && Taken[t] != s;
+						if(!Free)
+							break;
+						Taken[Placed++] = s;
+					}
+					if(Placed < Size)
+						continue;
+					Placed = 0;
+					for(std::size_t i = 0; i < N; i++)
+						if(Bucket(Hash(Names[i].Name)) == b)
+							Entries[Taken[Placed++]] = static_cast<std::uint32_t>(i + 1);
+					Displacements[b] = Displacement;
+					break;
+				}
+			}
+		}
 	}
 
 	/**
-	 * @brief Sets the name per parameter
-	 * 
-	 * @tparam ParamTypes list of parameter types
-	 * @param ParameterNames String names of the parameters
-	 * @return Argument& The argument reference
+	 * @brief Looks up the value of a name
+	 * @return const E* The value, nullptr if the name is not in the table
 	 */
-	template<typename ...ParamTypes>
-	Argument& ParameterName(ParamTypes... ParameterNames){
-		parameter_name<0, ParamTypes...>(std::tuple<ParamTypes...>(ParameterNames...));
-		return *this;
+	constexpr const E* Find(std::string_view Name) const noexcept {
+		const std::uint64_t h = Hash(Name);
+		const std::uint32_t Displacement = Displacements[Bucket(h)];
+		if(!Displacement)
+			return nullptr;
+		const std::uint32_t Entry = Entries[Slot(h, Displacement)];
+		return Entry && Names[Entry - 1].Name == Name ? &Names[Entry - 1].Value : nullptr;
 	}
 
 	/**
-	 * @brief Sets the default value per paramater
-	 * Default values for the argument. If the argument is not passed these values are used.
-	 * @tparam ParamTypes list of parameter types
-	 * @param defaultValues Default value per parameter
-	 * @return Argument& The argument reference
+	 * @brief Looks up the name of a value
+	 * @return std::string_view The first name of the value, empty if it has none
 	 */
-	template<typename ...ParamTypes>
-	Argument& DefaultValue(ParamTypes... defaultValues){
-		default_value<0, ParamTypes...>(std::tuple<ParamTypes...>(defaultValues...));
-		has_defaultValues = true;
-		return *this;
+	constexpr std::string_view NameOf(E Value) const noexcept {
+		for(const EnumName<E>& Entry : Names)
+			if(Entry.Value == Value)
+				return Entry.Name;
+		return std::string_view();
 	}
 
-	/**
-	 * @brief Sets the implicit value per parameter
-	 * Implicit values are values used if the argument is passed but no parameters are passed
-	 * @tparam ParamTypes list of parameter types
-	 * @param implicitValues Implicit value per parameter
-	 * @return Argument& The argument reference
-	 */
-	template<typename ...ParamTypes>
-	Argument& ImplicitValue(ParamTypes... implicitValues){
-		implicit_value<0, ParamTypes...>(std::tuple<ParamTypes...>(implicitValues...));
-		has_implicitValues = true;
-		return *this;
+	constexpr std::size_t size() const noexcept {return N;}
+	constexpr const EnumName<E>* begin() const noexcept {return Names.data();}
+	constexpr const EnumName<E>* end() const noexcept {return Names.data() + N;}
+};
+
+// Builds an EnumTable, deducing its size from the names
+template<typename E, std::size_t N>
+constexpr EnumTable<E, N> MakeEnumTable(const EnumName<E> (&Names)[N]){
+	return EnumTable<E, N>(Names);
+}
+
+/**
+ * @brief The names of the values of an enum, specialize it with a constexpr EnumTable named Table to convert the enum by name
+ * @code
+ * template<> struct ArgPar::EnumNames<Level> {
+ * 	static constexpr auto Table = ArgPar::MakeEnumTable<Level>({{"debug", Level::Debug}, {"info", Level::Info}});
+ * };
+ * @endcode
+ */
+template<typename E>
+struct EnumNames {};
+
+// Converts an enum with EnumNames by name, help lists the names
+template<typename E>
+struct Converter<E, std::enable_if_t<std::is_enum<E>::value, std::void_t<decltype(EnumNames<E>::Table)>>> {
+	static bool Convert(std::string_view s, E& value) noexcept {
+		const E* Found = EnumNames<E>::Table.Find(s);
+		if(Found)
+			value = *Found;
+		return Found != nullptr;
 	}
+	static void Format(const E& value, std::string& Out){Out.append(EnumNames<E>::Table.NameOf(value));}
+	static constexpr std::string_view Name(){return std::string_view(NameList.data(), NameList.size());}
 
-	/**
-	 * @brief Sets the help message for the argument
-	 * 
-	 * @param help the help message string
-	 * @return Argument& The argument reference
-	 */
-	Argument& Help(std::string help) {helpString = help; return *this;}
-	/**
-	 * @brief Sets the argument as required
-	 * If the argument is required but not passed an error is thrown during parsing
-	 * @return Argument& The argument reference
-	 */
-	Argument& Required(){required = true; return *this;}
+private:
+	// The names separated by |, joined at compile time
+	static constexpr std::size_t NameListSize = [](){
+		std::size_t Size = 0;
+		for(const EnumName<E>& Entry : EnumNames<E>::Table)
+			Size += Entry.Name.size() + 1;
+		return Size - 1;
+	}();
+	static constexpr std::array<char, NameListSize> NameList = [](){
+		std::array<char, NameListSize> List{};
+		std::size_t Length = 0;
+		for(const EnumName<E>& Entry : EnumNames<E>::Table){
+			if(Length)
+				List[Length++] = '|';
+			for(char c : Entry.Name)
+				List[Length++] = c;
+		}
+		return List;
+	}();
+};
 
-	/**
-	 * @brief Sets the parse always property
-	 * If an argument is set to be always parsed then even if not all required arguments are passed this argument will still be parsed.
-	 * @return Argument& The argument reference
-	 */
-	Argument& ParseAlways(){parseAlways = true; return *this;}
+/**
+ * @brief A size in bytes, converted from a number with an optional unit as 512, 4KiB, 2G or 1.5MB
+ * K, M, G, T, P and E are powers of 1024 as are KiB or Ki, KB is a power of 1000. Units ignore case, fractional bytes are truncated.
+ */
+struct ByteSize {
+	std::uint64_t Bytes = 0;
 
-	/**
+	friend constexpr bool operator==(ByteSize A, ByteSize B){return A.Bytes == B.Bytes;}
+	friend constexpr bool operator!=(ByteSize A, ByteSize B){return A.Bytes != B.Bytes;}
+};
+
+template<>
+struct Converter<ByteSize> {
+	static bool Convert(std::string_view s, ByteSize& value) noexcept {
+		DecimalNumber Number;
+		if(!ReadDecimal(s, Number))
+			return false;
+		std::uint64_t Unit = 1;
+		if(!s.empty() && !EqualsIgnoreCase(s, "B")){
+			constexpr std::string_view Prefixes = "kmgtpe";
+			const char Prefix = s[0] >= 'A' && s[0] <= 'Z' ? static_cast<char>(s[0] - 'A' + 'a') : s[0];
+			const std::size_t Power = Prefixes.find(Prefix);
+			const std::string_view Suffix = s.substr(1);
+			std::uint64_t Base;
+			if(Suffix.empty() || EqualsIgnoreCase(Suffix, "i") || EqualsIgnoreCase(Suffix, "iB"))
+				Base = 1024;
+			else if(EqualsIgnoreCase(Suffix, "B"))
+				Base = 1000;
+			else
+				return false;
+			if(Power == std::string_view::npos)
+				return false;
+			for(std::size_t p = 0; p <= Power; p++)
+				Unit *= Base;
+		}
+		return ScaleDecimal(Number, Unit, value.Bytes);
+	}
+	// Formats the size in the largest binary unit it is a whole multiple of
+	static void Format(const ByteSize& value, std::string& Out){
+		constexpr const char* Units[] = {"", "KiB", "MiB", "GiB", "TiB", "PiB", "EiB"};
+		std::uint64_t Bytes = value.Bytes;
+		std::size_t Unit = 0;
+		while(Bytes && Bytes % 1024 == 0 && Unit < 6){
+			Bytes /= 1024;
+			Unit++;
+		}
+		Out.append(std::to_string(Bytes)).append(Units[Unit]);
+	}
+	static constexpr std::string_view Name(){return "size";}
+};
+
+/**
+ * @brief Converts a duration from numbers with units as 250ms, 1.5s or 1h30m
+ * Units are ns, us, ms, s, m, min, h and d. The value is read in nanoseconds, it should be a whole number of the ticks of the duration.
+ */
+template<typename Rep, typename Period>
+struct Converter<std::chrono::duration<Rep, Period>> {
+	using Duration = std::chrono::duration<Rep, Period>;
+
+	static bool Convert(std::string_view s, Duration& value) noexcept {
+		constexpr std::pair<std::string_view, std::uint64_t> Units[] = {
+			{"ns", 1}, {"us", 1000}, {"\xC2\xB5s", 1000}, {"ms", 1000000}, {"s", 1000000000}, 
+			{"m", 60000000000}, {"min", 60000000000}, {"h", 3600000000000}, {"d", 86400000000000}
+		};
+		bool Negative = false;
+		if(!s.empty() && (s[0] == '-' || s[0] == '+')){
+			Negative = s[0] == '-';
+			s.remove_prefix(1);
+		}
+		std::uint64_t Nanoseconds = 0;
+		do {
+			DecimalNumber Number;
+			if(!ReadDecimal(s, Number))
+				return false;
+			std::size_t UnitLength = 0;
+			while(UnitLength < s.size() && !(s[UnitLength] >= '0' && s[UnitLength] <= '9') && s[UnitLength] != '.')
+				UnitLength++;
+			const std::string_view UnitName = s.substr(0, UnitLength);
+			s.remove_prefix(UnitLength);
+			std::uint64_t Unit = 0, Part;
+			for(const auto& Candidate : Units)
+				if(Candidate.first == UnitName)
+					Unit = Candidate.second;
+			if(!Unit && !(UnitName.empty() && !Number.Integer && !Number.Fraction && s.empty() && !Nanoseconds)) // a bare 0 needs no unit
+				return false;
+			if(!ScaleDecimal(Number, Unit, Part) || Part > std::numeric_limits<std::uint64_t>::max() - Nanoseconds)
+				return false;
+			Nanoseconds += Part;
+		} while(!s.empty());
+		if(Nanoseconds > static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max()))
+			return false;
+		const std::chrono::nanoseconds Read(Negative ? -static_cast<std::int64_t>(Nanoseconds) : static_cast<std::int64_t>(Nanoseconds));
+		if constexpr(std::chrono::treat_as_floating_point<Rep>::value)
+			value = std::chrono::duration_cast<Duration>(Read);
+		else{
+			// only whole ticks, 250ms is not a number of seconds
+			using Ratio = std::ratio_divide<Period, std::nano>;
+			if(Ratio::den != 1 || Read.count() % Ratio::num)
+				return false;
+			const std::int64_t Ticks = Read.count() / Ratio::num;
+			if(Ticks > static_cast<std::int64_t>(std::numeric_limits<Rep>::max()) || Ticks < static_cast<std::int64_t>(std::numeric_limits<Rep>::lowest()))
+				return false;
+			value = Duration(static_cast<Rep>(Ticks));
+		}
+		return true;
+	}
+	// Formats the duration in the largest unit it is a whole multiple of
+	static void Format(const Duration& value, std::string& Out){
+		constexpr std::pair<const char*, std::int64_t> Units[] = {
+			{"d", 86400000000000}, {"h", 3600000000000}, {"m", 60000000000}, {"s", 1000000000}, {"ms", 1000000}, {"us", 1000}, {"ns", 1}
+		};
+		const std::int64_t Nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(value).count();
+		for(const auto& Unit : Units){
+			if(Nanoseconds % Unit.second == 0 && (Nanoseconds || Unit.second == 1)){
+				Out.append(std::to_string(Nanoseconds / Unit.second)).append(Unit.first);
+				return;
+			}
+		}
+	}
+	static constexpr std::string_view Name(){return "duration";}
+};
+
+// An IPv4 address in network byte order, converted from dotted decimal notation as 192.168.0.1
+struct IPv4Address {
+	std::array<std::uint8_t, 4> Bytes{};
+
+	friend bool operator==(const IPv4Address& A, const IPv4Address& B){return A.Bytes == B.Bytes;}
+	friend bool operator!=(const IPv4Address& A, const IPv4Address& B){return A.Bytes != B.Bytes;}
+};
+
+// An IPv6 address in network byte order, converted from text as 2001:db8::1 or ::ffff:192.0.2.1
+struct IPv6Address {
+	std::array<std::uint8_t, 16> Bytes{};
+
+	friend bool operator==(const IPv6Address& A, const IPv6Address& B){return A.Bytes == B.Bytes;}
+	friend bool operator!=(const IPv6Address& A, const IPv6Address& B){return A.Bytes != B.Bytes;}
+};
+
+// An IPv4 or IPv6 address, an IPv4 address uses the first 4 bytes
+struct IPAddress {
+	enum class Family : std::uint8_t {V4, V6};
+	Family Version = Family::V4;
+	std::array<std::uint8_t, 16> Bytes{};
+
+	friend bool operator==(const IPAddress& A, const IPAddress& B){return A.Version == B.Version && A.Bytes == B.Bytes;}
+	friend bool operator!=(const IPAddress& A, const IPAddress& B){return !(A == B);}
+};
+
+template<>
+struct Converter<IPv4Address> {
+	// Reads exactly 4 decimal octets without leading zeros, which some parsers read as octal
+	static bool Convert(std::string_view s, IPv4Address& value) noexcept {
+		for(std::size_t Octet = 0; Octet < 4; Octet++){
+			if(Octet){
+				if(s.empty() || s[0] != '.')
+					return false;
+				s.remove_prefix(1);
+			}
+			std::size_t Digits = 0;
+			unsigned Number = 0;
+			while(Digits < s.size() && Digits < 4 && s[Digits] >= '0' && s[Digits] <= '9')
+				Number = Number * 10 + static_cast<unsigned>(s[Digits++] - '0');
+			if(!Digits || Digits > 3 || Number > 255 || (Digits > 1 && s[0] == '0'))
+				return false;
+			value.Bytes[Octet] = static_cast<std::uint8_t>(Number);
+			s.remove_prefix(Digits);
+		}
+		return s.empty();
+	}
+	static void Format(const IPv4Address& value, std::string& Out){
+		for(std::size_t Octet = 0; Octet < 4; Octet++)
+			Out.append(Octet ? "." : "").append(std::to_string(value.Bytes[Octet]));
+	}
+	static constexpr std::string_view Name(){return "ipv4";}
+};
+
+template<>
+struct Converter<IPv6Address> {
+	// Reads 8 groups of up to 4 hex digits, :: replaces one run of zero groups and the last 2 groups may be written as IPv4 address
+	static bool Convert(std::string_view s, IPv6Address& value) noexcept {
+		std::array<std::uint8_t, 16> Bytes{};
+		std::size_t Length = 0; // bytes read
+		constexpr std::size_t NoGap = std::numeric_limits<std::size_t>::max();
+		std::size_t Gap = NoGap; // where :: was
+		if(s.size() >= 2 && s[0] == ':' && s[1] == ':'){
+			Gap = 0;
+			s.remove_prefix(2);
+		}
+		else if(!s.empty() && s[0] == ':')
+			return false;
+		while(!s.empty()){
+			if(Length == 16)
+				return false;
+			std::size_t Digits = 0;
+			unsigned Group = 0;
+			for(; Digits < s.size() && Digits < 5; Digits++){
+				const char c = s[Digits];
+				const int Nibble = c >= '0' && c <= '9' ? c - '0' : c >= 'a' && c <= 'f' ? c - 'a' + 10 : c >= 'A' && c <= 'F' ? c - 'A' + 10 : -1;
+				if(Nibble < 0)
+					break;
+				Group = Group << 4 | static_cast<unsigned>(Nibble);
+			}
+			// a group followed by a dot is an IPv4 address, which ends the text
+			if(Digits < s.size() && s[Digits] == '.'){
+				IPv4Address Embedded;
+				if(Length > 12 || !Converter<IPv4Address>::Convert(s, Embedded))
+					return false;
+				for(std::uint8_t Byte : Embedded.Bytes)
+					Bytes[Length++] = Byte;
+				break;
+			}
+			if(!Digits || Digits > 4)
+				return false;
+			Bytes[Length++] = static_cast<std::uint8_t>(Group >> 8);
+			Bytes[Length++] = static_cast<std::uint8_t>(Group);
+			s.remove_prefix(Digits);
+			if(s.empty())
+				break;
+			if(s[0] != ':')
+				return false;
+			s.remove_prefix(1);
+			if(!s.empty() && s[0] == ':'){
+				if(Gap != NoGap)
+					return false; // :: may appear once
+				Gap = Length;
+				s.remove_prefix(1);
+			}
+			else if(s.empty())
+				return false; // a trailing single :
+		}
+		if(Gap == NoGap){
+			if(Length != 16)
+				return false;
+			value.Bytes = Bytes;
+			return true;
+		}
+		if(Length > 14)
+			return false; // :: stands for at least one group
+		// move the groups after :: to the end
+		const std::size_t Tail = Length - Gap;
+		value.Bytes.fill(0);
+		for(std::size_t i = 0; i < Gap; i++)
+			value.Bytes[i] = Bytes[i];
+		for(std::size_t i = 0; i < Tail; i++)
+			value.Bytes[16 - Tail + i] = Bytes[Gap + i];
+		return true;
+	}
+	// Formats the address as recommended by RFC 5952, lower case with the longest run of 2 or more zero groups as ::
+	static void Format(const IPv6Address& value, std::string& Out){
+		std::array<unsigned, 8> Groups{};
+		for(std::size_t g = 0; g < 8; g++)
+			Groups[g] = static_cast<unsigned>(value.Bytes[2 * g]) << 8 | value.Bytes[2 * g + 1];
+		std::size_t RunStart = 8, RunLength = 1;
+		for(std::size_t g = 0; g < 8;){
+			std::size_t End = g;
+			while(End < 8 && !Groups[End])
+				End++;
+			if(End - g > RunLength){
+				RunStart = g;
+				RunLength = End - g;
+			}
+			g = End > g ? End : g + 1;
+		}
+		constexpr char Hex[] = "0123456789abcdef";
+		for(std::size_t g = 0; g < 8; g++){
+			if(g == RunStart){
+				Out.append("::");
+				g += RunLength - 1;
+				continue;
+			}
+			if(g && g != RunStart + RunLength)
+				Out.push_back(':');
+			bool Leading = true;
+			for(int Shift = 12; Shift >= 0; Shift -= 4){
+				const unsigned Nibble = (Groups[g] >> Shift) & 0xF;
+				if(Leading && !Nibble && Shift)
+					continue;
+				Leading = false;
+				Out.push_back(Hex[Nibble]);
+			}
+		}
+	}
+	static constexpr std::string_view Name(){return "ipv6";}
+};
+
+template<>
+struct Converter<IPAddress> {
+	// Reads an IPv6 address if the text contains a colon, otherwise an IPv4 address
+	static bool Convert(std::string_view s, IPAddress& value) noexcept {
+		if(s.find(':') != std::string_view::npos){
+			IPv6Address Address;
+			if(!Converter<IPv6Address>::Convert(s, Address))
+				return false;
+			value.Version = IPAddress::Family::V6;
+			value.Bytes = Address.Bytes;
+			return true;
+		}
+		IPv4Address Address;
+		if(!Converter<IPv4Address>::Convert(s, Address))
+			return false;
+		value.Version = IPAddress::Family::V4;
+		value.Bytes.fill(0);
+		std::copy(Address.Bytes.begin(), Address.Bytes.end(), value.Bytes.begin());
+		return true;
+	}
+	static void Format(const IPAddress& value, std::string& Out){
+		if(value.Version == IPAddress::Family::V6){
+			IPv6Address Address;
+			Address.Bytes = value.Bytes;
+			Converter<IPv6Address>::Format(Address, Out);
+		}
+		else{
+			IPv4Address Address;
+			std::copy(value.Bytes.begin(), value.Bytes.begin() + 4, Address.Bytes.begin());
+			Converter<IPv4Address>::Format(Address, Out);
+		}
+	}
+	static constexpr std::string_view Name(){return "address";}
+};
+
+/**
+ * @brief Converts a string to a type T through the classes stream >> operator
+ * @tparam T type to convert to
+ * @param s the string to convert to T
+ * @return const T the converted value
+ * @throws invalid_argument exception if the conversion fails
+ */
+template<typename T>
+const T StreamToType(std::string_view s){
+	std::stringstream convert{std::string(s)};
+	T value;
+	convert >> value;
+	if(convert.fail())
+		throw std::invalid_argument("Conversion from \"" + std::string(s) + "\" to " + cached_type_name<T>() + " failed");
+	return value;
+}
+
+/**
+ * @brief Converts a string to a type T
+ * Types with a registered Converter are converted through it, arithmetic types, bool and std::string without allocating through FastConvert. 
+ * In both cases the whole string has to be a valid value. Other types are converted if the class has a stream >> operator implementation. 
+ * Types that can not be converted in any of these ways fail to compile
+ * @tparam T type to conver to
+ * @param s the string to convert to T
+ * @return const T the converted value
+ * @throws invalid_argument exception if the conversion fails. This can occur if the string is empty
+ */
+template<typename T>
+const typename std::enable_if<has_converter<T>::value || supports_fast_conversion<T>::value, T>::type ToType(std::string_view s) {
+	if(s.empty()){
+		throw std::invalid_argument("Conversion string is empty");
+	}
+	T value{};
+	if(!ConvertParameter(s, value))
+		throw std::invalid_argument("Conversion from \"" + std::string(s) + "\" to " + cached_type_name<T>() + " failed");
+	return value;
+}
+
+template<typename T>
+const typename std::enable_if<!has_converter<T>::value && !supports_fast_conversion<T>::value, T>::type ToType(std::string_view s) {
+	static_assert(supports_stream_conversion<T>::value, "Conversion from string to this type is not supported. "
+		"Either specialize ArgPar::Converter for the type or extend istream with std::istream& operator>>(std::istream&, T&)");
+	if(s.empty()){
+		throw std::invalid_argument("Conversion string is empty");
+	}
+	return StreamToType<T>(s);
+}
+
+//?==== Typed parameter storage ====?//
+
+// Type erased access to the converted parameter values of an argument
+class TypedValuesBase {
+public:
+	virtual ~TypedValuesBase() = default;
+	// Returns a pointer to the value at idx if it is stored as type, otherwise nullptr
+	virtual const void* Get(std::size_t idx, const std::type_info& type) const noexcept = 0;
+	// Formats the value at idx as parameter string, returns false if the value can not be formatted
+	virtual bool Format(std::size_t idx, std::string& Out) const = 0;
+	// The amount of values
+	virtual std::size_t size() const noexcept = 0;
+};
+
+// Holds the parameter values of an argument in their declared types, converted once from their string form
+template<typename ...ParamTypes>
+class TypedValues : public TypedValuesBase {
+	const std::tuple<ParamTypes...> Values;
+
+	template<std::size_t ...I>
+	static std::tuple<ParamTypes...> Convert(const std::string_view* Strings, std::index_sequence<I...>){
+		return std::tuple<ParamTypes...>(ToType<ParamTypes>(Strings[I])...);
+	}
+
+	template<std::size_t I = 0>
+	typename std::enable_if<I  < sizeof...(ParamTypes), const void*>::type GetAt(std::size_t idx, const std::type_info& type) const noexcept {
+		if(idx == I)
+			return typeid(typename std::tuple_element<I, std::tuple<ParamTypes...>>::type) == type ? &std::get<I>(Values) : nullptr;
+		return GetAt<I+1>(idx, type);
+	}
+	// SFINAE end condition
+	template<std::size_t I = 0>
+	typename std::enable_if<I == sizeof...(ParamTypes), const void*>::type GetAt(std::size_t, const std::type_info&) const noexcept {return nullptr;}
+
+	template<std::size_t I = 0>
+	typename std::enable_if<I  < sizeof...(ParamTypes), bool>::type FormatAt(std::size_t idx, std::string& Out) const {
+		using T = typename std::tuple_element<I, std::tuple<ParamTypes...>>::type;
+		if(idx == I){
+			if constexpr(supports_parameter_format<T>::value)
+				return FormatParameter(std::get<I>(Values), Out);
+			else
+				return false;
+		}
+		return FormatAt<I+1>(idx, Out);
+	}
+	// SFINAE end condition
+	template<std::size_t I = 0>
+	typename std::enable_if<I == sizeof...(ParamTypes), bool>::type FormatAt(std::size_t, std::string&) const {return false;}
+
+public:
+	explicit TypedValues(const std::string_view* Strings) : Values(Convert(Strings, std::index_sequence_for<ParamTypes...>{})) {}
+	explicit TypedValues(std::in_place_t, const ParamTypes&... Values) : Values(Values...) {}
+
+	const void* Get(std::size_t idx, const std::type_info& type) const noexcept override {return GetAt(idx, type);}
+	bool Format(std::size_t idx, std::string& Out) const override {return FormatAt(idx, Out);}
+	// Gets the value at I without checking its type
+	template<std::size_t I>
+	const typename std::tuple_element<I, std::tuple<ParamTypes...>>::type& At() const noexcept {return std::get<I>(Values);}
+	std::size_t size() const noexcept override {return sizeof...(ParamTypes);}
+
+	// Converts the string parameter values, throws invalid_argument if any of the conversions fail
+	static std::shared_ptr<const TypedValuesBase> FromStrings(const std::string_view* Strings){
+		return std::make_shared<const TypedValues<ParamTypes...>>(Strings);
+	}
+};
+
+// The type a default or implicit value is stored as until it is formatted, strings are interned and stored as views
+template<typename T>
+using stored_value_t = typename std::conditional<std::is_convertible<const T&, std::string_view>::value, std::string_view, T>::type;
+
+// checks if default or implicit values of these types are stored typed and only formatted once they are read as strings.
+// Values stored in the table of a parser are never destroyed, so their types have to be trivially destructible, and at least one should not be a string
+template<typename ...ValueTypes>
+using formats_lazily = std::conjunction<std::disjunction<std::negation<std::is_same<stored_value_t<ValueTypes>, std::string_view>>...>, 
+	std::is_trivially_destructible<stored_value_t<ValueTypes>>..., std::is_copy_constructible<stored_value_t<ValueTypes>>..., supports_parameter_format<stored_value_t<ValueTypes>>...>;
+
+class ArgumentParser;
+class Argument;
+class ParsedArgument;
+class ParseResult;
+class MappedFile;
+template<typename Instrumentation>
+class IncrementalParser;
+
+template<typename T>
+class ArrayTokenSource;
+template<typename Source>
+class ResponseFileTokenSource;
+
+// Writes unescaped tokens into a reused buffer, a token is only valid until the next token is unescaped
+struct TransientUnescape {
+	std::string Buffer;
+
+	void Begin(const char* Token, std::size_t Length){Buffer.assign(Token, Length);}
+	void Append(const char* p, std::size_t Length){Buffer.append(p, Length);}
+	void Push(char c){Buffer.push_back(c);}
+	std::string_view Finish() const {return Buffer;}
+};
+
+/**
+ * @brief A lazily read sequence of parsed tokens, like the operands or the values of a variadic argument
+ * The tokens are not copied, the range stores runs of consecutive tokens of the parsed argv, token vector or response file 
+ * and reads them while iterating. Tokens of response files are split again on every iteration, the file is kept by the result.
+ * The parsed argv, token vector and strings should outlive the range.
+ */
+class TokenRange {
+	template<typename> friend class ArrayTokenSource;
+	template<typename> friend class ResponseFileTokenSource;
+	friend class ArgumentParser;
+	template<const auto&...> friend class StaticParser;
+
+	// Consecutive tokens of a parsed source
+	struct Run {
+		enum Kind : unsigned char {Strings, Views, Text};
+		Kind kind;
+		const void* first; // const char* const*, const std::string_view* or the first byte of the text
+		const void* owner; // the file the text of a text run is part of
+		std::size_t bytes; // size of the text of a text run
+		std::size_t count; // tokens in the run
+	};
+	std::vector<Run> Runs;
+	std::size_t Count = 0;
+
+	// Adds an array element, extending the last run if the element follows it
+	template<typename T>
+	void AddElement(const T* Token, typename Run::Kind kind){
+		if(!Runs.empty() && Runs.back().kind == kind && static_cast<const T*>(Runs.back().first) + Runs.back().count == Token)
+			Runs.back().count++;
+		else
+			Runs.push_back(Run{kind, Token, nullptr, 0, 1});
+		Count++;
+	}
+	void Add(const char* const* Token){AddElement(Token, Run::Strings);}
+	void Add(const std::string_view* Token){AddElement(Token, Run::Views);}
+	// Adds a token read from the text [begin, end) of owner, whitespace before the token may be included
+	void Add(const void* owner, const char* begin, const char* end){
+		if(!Runs.empty() && Runs.back().kind == Run::Text && Runs.back().owner == owner && static_cast<const char*>(Runs.back().first) + Runs.back().bytes == begin){
+			Runs.back().bytes += static_cast<std::size_t>(end - begin);
+			Runs.back().count++;
+		}
+		else
+			Runs.push_back(Run{Run::Text, begin, owner, static_cast<std::size_t>(end - begin), 1});
+		Count++;
+	}
+
+public:
+	/**
+	 * @brief Reads the tokens of a TokenRange one at a time
+	 * Dereferencing gives a view that is valid as long as the range, unescaped tokens of response files only until the iterator is advanced.
+	 */
+	class iterator {
+		friend class TokenRange;
+
+		const Run* run = nullptr;
+		const Run* last = nullptr;
+		std::size_t pos = 0; // token in the run
+		const char* p = nullptr; // read position in a text run
+		std::string_view Token;
+		TransientUnescape Unescaped;
+		bool InBuffer = false; // the token is in Unescaped, which moves when the iterator is copied
+
+		iterator(const Run* run, const Run* last) : run(run), last(last) {Read();}
+		// Reads the token at pos, moving on to the next run at the end of a run
+		void Read();
+
+	public:
+		using iterator_category = std::input_iterator_tag;
+		using value_type = std::string_view;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const std::string_view*;
+		using reference = std::string_view;
+
+		iterator() = default;
+		std::string_view operator*() const {return InBuffer ? Unescaped.Finish() : Token;}
+		iterator& operator++(){
+			pos++;
+			Read();
+			return *this;
+		}
+		iterator operator++(int){
+			iterator Previous(*this);
+			++*this;
+			return Previous;
+		}
+		bool operator==(const iterator& Other) const {return run == Other.run && pos == Other.pos;}
+		bool operator!=(const iterator& Other) const {return !(*this == Other);}
+	};
+
+	iterator begin() const {return iterator(Runs.data(), Runs.data() + Runs.size());}
+	iterator end() const {return iterator(Runs.data() + Runs.size(), Runs.data() + Runs.size());}
+	std::size_t size() const {return Count;}
+	bool empty() const {return Count == 0;}
+};
+
+// The values a single parse produced for an argument
+struct ParsedValues {
+	bool is_used = false;
+	// Parameter values viewing the parsed tokens or the implicit values, a view without data means the default value is used
+	std::vector<std::string_view> views;
+	// Converted parameter values, only set in typed storage mode
+	std::shared_ptr<const TypedValuesBase> typed;
+	// Every parameter value once one was changed through Argument::operator[], read instead of the views and typed values
+	std::vector<std::string> owned;
+};
+
+//?==== Instrumentation ====?//
+
+// The phases of a parse that are timed by ParseInstrumentation
+enum class ParsePhase : std::size_t {
+	Tokenize,		// splitting a command line string into tokens, only for ParseCommandLine
+	Scan,			// classifying tokens and grouping parameters with their argument, includes Lookup
+	Lookup,			// finding the argument of a callee
+	RequiredCheck,	// checking all required arguments were passed
+	Arguments,		// parsing the parameters of every passed argument, includes Validator, Conversion and Action
+	Validator,		// running validators
+	Conversion,		// converting parameters of Typed() arguments
+	Action,			// running actions
+	Count
+};
+
+/**
+ * @brief The default instrumentation policy of the parse functions, it does nothing
+ * Every call inlines to nothing, such that parsing without instrumentation costs nothing.
+ * A custom policy provides the same members, see ParseInstrumentation.
+ */
+struct NoInstrumentation {
+	static constexpr bool Enabled = false;
+
+	// Times a phase for the lifetime of the object
+	struct Timer {
+		Timer(NoInstrumentation&, ParsePhase) noexcept {}
+	};
+
+	void TokenClassified(std::string_view, bool) noexcept {}
+	void LookedUp(std::string_view, const Argument*) noexcept {}
+	void ValidatorRun(const Argument&, std::size_t) noexcept {}
+	void ActionRun(const Argument&) noexcept {}
+	void Converted(const Argument&, std::size_t) noexcept {}
+	void Allocated(std::size_t) noexcept {}
+
+	// Workers of concurrent actions collect into a reset copy, which is added to the policy of the parse afterwards
+	void Reset() noexcept {}
+	NoInstrumentation& operator+=(const NoInstrumentation&) noexcept {return *this;}
+};
+
+/**
+ * @brief Collects per phase timings, counters and calls event hooks during a parse
+ * Pass it to ParseArguments, ParseCommandLine or Parse. Timings and counters add up over multiple parses until Reset is called.
+ * An instrumentation object should only be used by one parse at a time, use one per thread when parsing concurrently.
+ */
+class ParseInstrumentation {
+public:
+	static constexpr bool Enabled = true;
+	using Clock = std::chrono::steady_clock;
+	static constexpr std::size_t PhaseCount = static_cast<std::size_t>(ParsePhase::Count);
+
+	// Times a phase for the lifetime of the object
+	class Timer {
+		ParseInstrumentation& Instrumentation;
+		ParsePhase Phase;
+		Clock::time_point Start;
+	public:
+		Timer(ParseInstrumentation& Instrumentation, ParsePhase Phase) : Instrumentation(Instrumentation), Phase(Phase), Start(Clock::now()) {}
+		~Timer(){Instrumentation.PhaseTimes[static_cast<std::size_t>(Phase)] += Clock::now() - Start;}
+	};
+
+	std::array<Clock::duration, PhaseCount> PhaseTimes{};
+
+	std::size_t Tokens = 0;			// tokens classified as argument or parameter
+	std::size_t Lookups = 0;		// callee lookups, including those of unknown callees
+	std::size_t Conversions = 0;	// parameters converted to their type while parsing
+	std::size_t Validators = 0;		// validator calls
+	std::size_t Actions = 0;		// action calls
+	std::size_t Allocations = 0;	// heap allocations the parser made for argument data and parameter buffers
+
+	// Event hooks, called when set
+	std::function<void(std::string_view Token, bool isArgument)> OnTokenClassified;
+	std::function<void(const Argument& Arg, std::string_view Token)> OnArgumentMatched;
+	std::function<void(const Argument& Arg, std::size_t FailedPosition)> OnValidatorRun; // FailedPosition is 0 if the validator passed
+	std::function<void(const Argument& Arg)> OnActionRun;
+
+	// Gets the total time spent in a phase
+	Clock::duration Time(ParsePhase Phase) const {return PhaseTimes[static_cast<std::size_t>(Phase)];}
+
+	// Resets the timings and counters, the hooks are kept
+	void Reset(){
+		PhaseTimes.fill(Clock::duration::zero());
+		Tokens = Lookups = Conversions = Validators = Actions = Allocations = 0;
+	}
+
+	// Adds the timings and counters of another instrumentation, the hooks are kept
+	ParseInstrumentation& operator+=(const ParseInstrumentation& Other){
+		for(std::size_t i = 0; i < PhaseCount; i++)
+			PhaseTimes[i] += Other.PhaseTimes[i];
+		Tokens += Other.Tokens;
+		Lookups += Other.Lookups;
+		Conversions += Other.Conversions;
+		Validators += Other.Validators;
+		Actions += Other.Actions;
+		Allocations += Other.Allocations;
+		return *this;
+	}
+
+	//?==== Called by the parser ====?//
+	void TokenClassified(std::string_view Token, bool isArgument){
+		Tokens++;
+		if(OnTokenClassified)
+			OnTokenClassified(Token, isArgument);
+	}
+	void LookedUp(std::string_view Token, const Argument* Found){
+		Lookups++;
+		if(Found && OnArgumentMatched)
+			OnArgumentMatched(*Found, Token);
+	}
+	void ValidatorRun(const Argument& Arg, std::size_t FailedPosition){
+		Validators++;
+		if(OnValidatorRun)
+			OnValidatorRun(Arg, FailedPosition);
+	}
+	void ActionRun(const Argument& Arg){
+		Actions++;
+		if(OnActionRun)
+			OnActionRun(Arg);
+	}
+	void Converted(const Argument&, std::size_t ParameterCount){Conversions += ParameterCount;}
+	void Allocated(std::size_t Count){Allocations += Count;}
+
+	// Prints the phase timings in microseconds and the counters
+	friend std::ostream& operator<<(std::ostream& os, const ParseInstrumentation& Instrumentation){
+		static const char* const PhaseNames[PhaseCount] = {"tokenize", "scan", "lookup", "required check", "arguments", "validator", "conversion", "action"};
+		for(std::size_t i = 0; i < PhaseCount; i++)
+			os << std::left << std::setw(16) << PhaseNames[i] << std::chrono::duration<double, std::micro>(Instrumentation.PhaseTimes[i]).count() << " us\n";
+		os << "tokens: " << Instrumentation.Tokens << ", lookups: " << Instrumentation.Lookups << ", conversions: " << Instrumentation.Conversions 
+		   << ", validators: " << Instrumentation.Validators << ", actions: " << Instrumentation.Actions << ", allocations: " << Instrumentation.Allocations;
+		return os;
+	}
+};
+
+//?==== Argument storage ====?//
+
+/**
+ * @brief Stores the strings of the arguments of a parser in large blocks, equal strings are stored once
+ * Callees, parameter names, default values and help strings of thousands of arguments take a few blocks instead of an allocation each, 
+ * and strings shared by many arguments, as type names and help strings, are stored once. Interned strings stay valid as long as the pool. 
+ * Strings are never freed before the pool, so a value replaced by calling DefaultValue, ImplicitValue or Help again keeps its bytes until the parser is destroyed.
+ * The blocks also hold the arrays of views of the arguments and their typed default and implicit values, see Views and Create.
+ */
+class StringPool {
+	static constexpr std::size_t BlockSize = 16384;
+
+	std::vector<std::unique_ptr<char[]>> Blocks;
+	char* Free = nullptr;
+	std::size_t FreeSize = 0;
+	std::size_t BlockBytes = 0;
+	// The interned strings by their hash, open addressing with linear probing. Free slots have no data
+	std::vector<std::string_view> Slots;
+	std::size_t Count = 0;
+
+	// Allocates memory from the current block, allocations larger than a quarter block get a block of their own
+	void* Allocate(std::size_t Size, std::size_t Align){
+		std::size_t Padding = (Align - reinterpret_cast<std::uintptr_t>(Free) % Align) % Align;
+		if(Size + Padding > FreeSize){
+			if(Size > BlockSize / 4){
+				Blocks.emplace_back(new char[Size]); // new[] aligns for any fundamental type
+				BlockBytes += Size;
+				return Blocks.back().get();
+			}
+			Blocks.emplace_back(new char[BlockSize]);
+			BlockBytes += BlockSize;
+			Free = Blocks.back().get();
+			FreeSize = BlockSize;
+			Padding = 0;
+		}
+		void* Memory = Free + Padding;
+		Free += Padding + Size;
+		FreeSize -= Padding + Size;
+		return Memory;
+	}
+
+	// Gets the slot of a string, or the free slot it belongs in
+	std::size_t Find(std::string_view s) const noexcept {
+		const std::size_t Mask = Slots.size() - 1;
+		std::size_t Slot = std::hash<std::string_view>()(s) & Mask;
+		while(Slots[Slot].data() && Slots[Slot] != s)
+			Slot = (Slot + 1) & Mask;
+		return Slot;
+	}
+
+	void Grow(){
+		std::vector<std::string_view> Old(Slots.empty() ? 64 : Slots.size() * 2);
+		Old.swap(Slots);
+		for(std::string_view s : Old)
+			if(s.data())
+				Slots[Find(s)] = s;
+	}
+
+public:
+	StringPool() = default;
+	StringPool(const StringPool&) = delete;
+	StringPool& operator=(const StringPool&) = delete;
+
+	/**
+	 * @brief Stores a string once
+	 * @return std::string_view A view of the stored string, equal strings get the same view
+	 */
+	std::string_view Intern(std::string_view s){
+		if(s.empty())
+			return std::string_view("", 0);
+		if(2 * (Count + 1) > Slots.size())
+			Grow();
+		const std::size_t Slot = Find(s);
+		if(!Slots[Slot].data()){
+			char* Copy = static_cast<char*>(Allocate(s.size(), 1));
+			std::memcpy(Copy, s.data(), s.size());
+			Slots[Slot] = std::string_view(Copy, s.size());
+			Count++;
+		}
+		return Slots[Slot];
+	}
+
+	// Allocates an array of empty views, valid as long as the pool
+	std::string_view* Views(std::size_t Size){
+		if(!Size)
+			return nullptr;
+		std::string_view* Array = static_cast<std::string_view*>(Allocate(Size * sizeof(std::string_view), alignof(std::string_view)));
+		std::uninitialized_fill_n(Array, Size, std::string_view("", 0));
+		return Array;
+	}
+
+	// Constructs an object in the blocks, it is never destroyed so its members should be trivially destructible
+	template<typename T, typename ...Args>
+	const T* Create(Args&&... args){
+		return new(Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+	}
+
+	// The amount of distinct strings
+	std::size_t size() const noexcept {return Count;}
+	// The heap memory used by the blocks and the slots
+	std::size_t Bytes() const noexcept {
+		return BlockBytes + Blocks.capacity() * sizeof(std::unique_ptr<char[]>) + Slots.capacity() * sizeof(std::string_view);
+	}
+};
+
+// Properties of an argument, stored as bits per argument in ArgumentTable::Flags
+enum class ArgumentFlag : std::uint16_t {
+	Required 		= 1 << 0,
+	ImplicitValues 	= 1 << 1,
+	DefaultValues 	= 1 << 2,
+	IsFlag 			= 1 << 3,
+	ParseAlways 	= 1 << 4,
+	NeedsParameters = 1 << 5, // the action takes the parameters, cleared if it runs before parsing them
+	Typed 			= 1 << 6,
+	Variadic 		= 1 << 7,
+	Repeatable 		= 1 << 8
+};
+
+/**
+ * @brief The arguments of a parser as columns indexed by the position of the argument
+ * Scanning tokens reads the flags, parameter count and priority of every passed argument, these are kept in dense arrays 
+ * rather than spread over the argument objects so the scan of a large schema stays in cache. The strings of the arguments are interned in Strings.
+ */
+struct ArgumentTable {
+	std::vector<std::uint16_t> Flags;
+	std::vector<std::uint32_t> ParamCounts;
+	std::vector<std::size_t> Priorities;
+	StringPool Strings;
+	// Guards formatting default and implicit values into Strings while parsing, see Argument::FormatValues
+	std::mutex FormatMutex;
+
+	bool Has(std::size_t Index, ArgumentFlag Flag) const noexcept {return Flags[Index] & static_cast<std::uint16_t>(Flag);}
+	void Set(std::size_t Index, ArgumentFlag Flag, bool Value = true) noexcept {
+		if(Value)
+			Flags[Index] |= static_cast<std::uint16_t>(Flag);
+		else
+			Flags[Index] &= static_cast<std::uint16_t>(~static_cast<std::uint16_t>(Flag));
+	}
+
+	// Adds the row of an argument, returns its index
+	std::size_t Add(std::size_t ParamCount){
+		Flags.push_back(static_cast<std::uint16_t>(ArgumentFlag::NeedsParameters));
+		ParamCounts.push_back(static_cast<std::uint32_t>(ParamCount));
+		Priorities.push_back(0);
+		return Flags.size() - 1;
+	}
+
+	std::size_t size() const noexcept {return Flags.size();}
+	// The heap memory used by the columns, without the strings
+	std::size_t Bytes() const noexcept {
+		return Flags.capacity() * sizeof(std::uint16_t) + ParamCounts.capacity() * sizeof(std::uint32_t) 
+			 + Priorities.capacity() * sizeof(std::size_t);
+	}
+};
+
+/**
+ * @brief The memory used by the arguments of a parser, see ArgumentParser::MemoryUsage
+ * Heap sizes are counted from the capacities of the containers, the nodes of the callee index are estimated.
+ */
+struct MemoryReport {
+	std::size_t Arguments = 0;
+	std::size_t ArgumentBytes = 0;	// the argument objects and their extras
+	std::size_t TableBytes = 0;		// the flag, parameter count and priority columns
+	std::size_t StringBytes = 0;	// the interned strings and the parameter string arrays
+	std::size_t Strings = 0;		// the amount of distinct interned strings
+	std::size_t IndexBytes = 0;		// the callee index and the list of arguments
+
+	std::size_t Total() const noexcept {return ArgumentBytes + TableBytes + StringBytes + IndexBytes;}
+	std::size_t BytesPerArgument() const noexcept {return Arguments ? Total() / Arguments : 0;}
+
+	friend std::ostream& operator<<(std::ostream& os, const MemoryReport& Usage){
+		os << "arguments: " << Usage.Arguments << ", objects: " << Usage.ArgumentBytes << " B, table: " << Usage.TableBytes 
+		   << " B, strings: " << Usage.StringBytes << " B (" << Usage.Strings << " distinct), index: " << Usage.IndexBytes 
+		   << " B, total: " << Usage.Total() << " B, per argument: " << Usage.BytesPerArgument() << " B";
+		return os;
+	}
+};
+
+class Argument {
+	friend class ArgumentParser;
+	friend class ParsedArgument;
+	friend class ParseResult;
+	friend class ParseError;
+	template<typename> friend class IncrementalParser;
+	template<typename...> friend class ArgumentHandle;
+
+	static constexpr std::string_view DefaultHelp = "Look at me, I forgot to add a help string!";
+
+	// The row of the argument in the table of its parser, holding its flags, parameter count and priority
+	ArgumentTable* _Table;
+	// Position of the argument in the order it was added, indexes its row and its values in a ParseResult
+	std::uint32_t _index = 0;
+
+	// Incremented whenever a detail shown in the help changes, invalidates the help cached by the ArgumentParser
+	std::uint32_t _revision = 0;
+
+	// The parser the argument was added to, keeps its set of required arguments up to date
+	ArgumentParser* _Parser = nullptr;
+
+	// The callees, the second is empty if the argument has a single callee. These view strings interned in the table
+	std::array<std::string_view, 2> Callees;
+	std::string_view helpString = DefaultHelp;
+
+	// The parameter names, default values and implicit values, ParamCount() of each, interned in the table
+	std::string_view* _ParamStrings = nullptr;
+	// Default and implicit values kept in their types, formatted into _ParamStrings once they are read as strings, see FormatValues
+	const TypedValuesBase* _DefaultValues = nullptr;
+	const TypedValuesBase* _ImplicitValues = nullptr;
+	// Set while typed default or implicit values are not formatted yet
+	mutable std::atomic<bool> _Unformatted{false};
+
+	// Values of the last ArgumentParser::ParseArguments call
+	ParsedValues _Values;
+	// Every value of the last ArgumentParser::ParseArguments call, only collected for variadic and repeatable arguments
+	TokenRange _ValueRange;
+
+	// Details most arguments do not have, allocated when the first of them is set
+	struct Extras {
+		std::function<void(const std::vector<std::string>&)> Action;
+		std::function<std::size_t(const std::vector<std::string>&)> Validator;
+		// Arguments of the same priority that are parsed before this one, see DependsOn
+		std::vector<std::size_t> Dependencies;
+		// Converted default values, only set in typed storage mode
+		std::shared_ptr<const TypedValuesBase> TypedDefaults;
+		// Default values changed through operator[], used instead of the interned default values once set
+		std::vector<std::string> Values;
+	};
+	std::unique_ptr<Extras> _Extras;
+
+	// Converts string parameter values to the types the argument was added with, set by ArgumentParser::addArgument
+	std::shared_ptr<const TypedValuesBase> (*_f_ConvertTyped)(const std::string_view*) = nullptr;
+
+	// Gets the type of the ParamTypes parameter pack at index I
+	template<std::size_t I, typename ...ParamTypes>
+	using TupleTypeAt = typename std::tuple_element<I, std::tuple<ParamTypes...>>::type;
+
+	//?==== Row access ====?//
+
+	bool Has(ArgumentFlag Flag) const noexcept {return _Table->Has(_index, Flag);}
+	void Set(ArgumentFlag Flag, bool Value = true) noexcept {_Table->Set(_index, Flag, Value);}
+	std::size_t ParamCount() const noexcept {return _Table->ParamCounts[_index];}
+	std::size_t Priority() const noexcept {return _Table->Priorities[_index];}
+
+	std::string_view ParamName(std::size_t idx) const noexcept {return _ParamStrings[idx];}
+	std::string_view ImplicitValueView(std::size_t idx) const {
+		FormatValues();
+		return _ParamStrings[2 * ParamCount() + idx];
+	}
+	std::string_view DefaultValueView(std::size_t idx) const {
+		if(ChangedDefaults())
+			return _Extras->Values[idx];
+		FormatValues();
+		return _ParamStrings[ParamCount() + idx];
+	}
+	// Sets a default value interned in the table
+	void SetDefaultValue(std::size_t idx, std::string_view Value){
+		_ParamStrings[ParamCount() + idx] = Value;
+		if(ChangedDefaults())
+			_Extras->Values[idx] = Value;
+	}
+	// Checks if the default values were changed through operator[]
+	bool ChangedDefaults() const noexcept {return _Extras && !_Extras->Values.empty();}
+
+	// Formats the typed default and implicit values into the parameter strings, once they are read as strings
+	void FormatValues() const {
+		if(!_Unformatted.load(std::memory_order_acquire))
+			return;
+		// concurrent parses may read the strings of the same argument
+		std::lock_guard<std::mutex> Lock(_Table->FormatMutex);
+		if(!_Unformatted.load(std::memory_order_relaxed))
+			return;
+		std::string Formatted;
+		const std::size_t ParamCount = this->ParamCount();
+		const TypedValuesBase* const Typed[2] = {_DefaultValues, _ImplicitValues};
+		for(std::size_t k = 0; k < 2; k++){
+			for(std::size_t i = 0; Typed[k] && i < Typed[k]->size(); i++){
+				if(!Typed[k]->Format(i, Formatted))
+					ThrowUnformattable(k ? "Implicit" : "Default", i, {});
+				_ParamStrings[(k + 1) * ParamCount + i] = _Table->Strings.Intern(Formatted);
+			}
+		}
+		_Unformatted.store(false, std::memory_order_release);
+	}
+
+	[[noreturn]] void ThrowUnformattable(const char* Kind, std::size_t Position, std::string_view TypeName) const {
+		throw std::invalid_argument(std::string(Kind) + " value for argument " + std::string(Callees[0]) + " at position " + std::to_string(Position) + " is invalid, "
+									"Conversion " + (TypeName.empty() ? std::string() : "from " + std::string(TypeName) + " ") + "to string failed.");
+	}
+
+	// Interns a default or implicit value as parameter string, strings are interned as they are
+	template<typename T>
+	std::string_view InternValue(const char* Kind, std::size_t Position, const T& Value){
+		if constexpr(std::is_convertible<const T&, std::string_view>::value){
+			if constexpr(std::is_pointer<T>::value)
+				if(!Value)
+					ThrowUnformattable(Kind, Position, type_name<T>());
+			return _Table->Strings.Intern(Value);
+		}
+		else{
+			std::string Formatted;
+			if(!FormatParameter(Value, Formatted))
+				ThrowUnformattable(Kind, Position, type_name<T>());
+			return _Table->Strings.Intern(Formatted);
+		}
+	}
+
+	/**
+	 * @brief Stores default or implicit values in their types in the table, they are formatted once they are read as strings
+	 * @return const TypedValuesBase* The stored values, nullptr if they can not be stored and should be formatted right away, see formats_lazily
+	 */
+	template<std::size_t ...I, typename ...ValueTypes>
+	const TypedValuesBase* StoreValues(const char* Kind, std::index_sequence<I...>, const ValueTypes&... Values){
+		if constexpr(formats_lazily<ValueTypes...>::value){
+			const TypedValuesBase* Stored = _Table->Strings.template Create<TypedValues<stored_value_t<ValueTypes>...>>(std::in_place, StoredValue(Kind, I, Values)...);
+			_Unformatted.store(true, std::memory_order_release);
+			return Stored;
+		}
+		else{
+			(void)Kind;
+			((void)Values, ...);
+			return nullptr;
+		}
+	}
+	template<typename T>
+	stored_value_t<T> StoredValue(const char* Kind, std::size_t Position, const T& Value){
+		if constexpr(std::is_same<stored_value_t<T>, std::string_view>::value)
+			return InternValue(Kind, Position, Value);
+		else
+			return Value;
+	}
+
+	// Values are set per parameter, more values than parameters would write past the parameter strings
+	void CheckValueCount(std::size_t Count) const {
+		if(Count > ParamCount())
+			throw std::invalid_argument("Argument " + std::string(Callees[0]) + " takes " + std::to_string(ParamCount()) + " parameters, " + std::to_string(Count) + " values were given");
+	}
+
+	Extras& MutableExtras(){
+		if(!_Extras)
+			_Extras = std::make_unique<Extras>();
+		return *_Extras;
+	}
+	bool HasAction() const noexcept {return _Extras && _Extras->Action;}
+	bool HasValidator() const noexcept {return _Extras && _Extras->Validator;}
+	const TypedValuesBase* TypedDefaults() const noexcept {return _Extras ? _Extras->TypedDefaults.get() : nullptr;}
+	const std::vector<std::size_t>& Dependencies() const noexcept {
+		static const std::vector<std::size_t> None;
+		return _Extras ? _Extras->Dependencies : None;
+	}
+	std::size_t CalleeCount() const noexcept {return Callees[1].empty() ? 1 : 2;}
+
+	// Formats parameter names and default values if present
+	void FormatParameters(std::string& Out) const{
+		if(Has(ArgumentFlag::IsFlag))
+			return;
+		const std::size_t ParamCount = this->ParamCount();
+		for(std::size_t i = 0; i < ParamCount; i++){
+			Out += '[';
+			Out += ParamName(i);
+			if(Has(ArgumentFlag::ImplicitValues)){
+				std::string_view implicitStringValue = ImplicitValueView(i);
+				// remove trailing 0s of decimal numbers, values as 10.0.0.0 have more than one dot
+				if(implicitStringValue.find('.') != std::string_view::npos && implicitStringValue.find('.') == implicitStringValue.rfind('.')){
+					implicitStringValue = implicitStringValue.substr(0, implicitStringValue.find_last_not_of('0')+1);
+					if(implicitStringValue.find('.') == implicitStringValue.size()-1)
+						implicitStringValue.remove_suffix(1);
+				}
+				Out += ": ";
+				Out += implicitStringValue;
+			}
+			Out += "] ";
+		}
+		if(Has(ArgumentFlag::Variadic))
+			Out += "... ";
+		if(Has(ArgumentFlag::DefaultValues)){
+			Out += " default: ";
+			for(std::size_t i = 0; i < ParamCount; i++){
+				Out += ParamName(i);
+				Out += '(';
+				Out += DefaultValueView(i);
+				Out += ") ";
+			}
+		}
+	}
+	void FormatParameters(std::stringstream& ss) const{
+		std::string Out;
+		FormatParameters(Out);
+		ss << Out;
+	}
+
+	/**
+	 * @brief Appends text where every line after the first is indented to a column
+	 * @param Out The string to append to
+	 * @param Text The text, newlines start a new indented line
+	 * @param Column The indentation after the leading tab
+	 * @param Width The width lines are wrapped at spaces to fit in, 0 disables wrapping. A tab is counted as 8 characters
+	 */
+	static void AppendWrapped(std::string& Out, std::string_view Text, std::size_t Column, std::size_t Width){
+		const std::size_t TabWidth = 8;
+		const std::size_t LineWidth = Width > TabWidth + Column ? Width - TabWidth - Column : 0;
+		auto NewLine = [&](){
+			Out += "\n\t";
+			Out.append(Column, ' ');
+		};
+		for(bool firstLine = true;; firstLine = false){
+			const std::size_t end = Text.find('\n');
+			const std::string_view Paragraph = Text.substr(0, end);
+			if(!firstLine)
+				NewLine();
+			if(!LineWidth || Paragraph.size() <= LineWidth)
+				Out += Paragraph;
+			else{
+				// greedily fill lines word by word, words longer than a line get a line of their own
+				std::size_t LineLength = 0;
+				for(std::size_t pos = 0; pos < Paragraph.size();){
+					const std::size_t wordEnd = std::min(Paragraph.find(' ', pos), Paragraph.size());
+					const std::string_view Word = Paragraph.substr(pos, wordEnd - pos);
+					if(LineLength && LineLength + 1 + Word.size() > LineWidth){
+						NewLine();
+						LineLength = 0;
+					}
+					else if(LineLength){
+						Out += ' ';
+						LineLength++;
+					}
+					Out += Word;
+					LineLength += Word.size();
+					pos = wordEnd + 1;
+				}
+			}
+			if(end == std::string_view::npos)
+				break;
+			Text.remove_prefix(end + 1);
+		}
+	}
+
+	/**
+	 * @brief Appends the help of the argument: its callees, help string and usage
+	 * @param Out The string to append to
+	 * @param Column The column the help string starts at after the leading tab, callees that do not fit get a line of their own
+	 * @param Width The width the help string is wrapped to, 0 disables wrapping
+	 */
+	void RenderHelp(std::string& Out, std::size_t Column, std::size_t Width) const {
+		const std::string calleeFormatted = GetCalleeFormatted();
+		Out += '\t';
+		Out += calleeFormatted;
+		if(calleeFormatted.length() >= Column){
+			Out += "\n\t";
+			Out.append(Column, ' ');
+		}
+		else
+			Out.append(Column - calleeFormatted.length(), ' ');
+		AppendWrapped(Out, helpString, Column, Width);
+		Out += "\n\t";
+		Out.append(Column, ' ');
+		Out += "Usage: ";
+		Out += Callees[0];
+		Out += ' ';
+		FormatParameters(Out);
+		Out += '\n';
+	}
+
+	// Formats the Callee's
+	std::string GetCalleeFormatted() const {
+		std::string calleeFormatted(Callees[0]);
+		if(CalleeCount() > 1){
+			calleeFormatted += ", ";
+			calleeFormatted += Callees[1];
+		}
+		return calleeFormatted;
+	}
+
+	//?==== Argument parser logic ====?//
+	/**
+	 * @brief Parses parameters given to the argument
+	 * First sets up a buffer containing the values based on implicit parameter values or default values, then performs a validator if set and then calls the custom function set by .Action() if set.
+	 * Implicit values are used over default values if not all parameter values are specified.
+	 * @param Parameters The list of parameters passed through CLI, these are viewed and should outlive the argument values
+	 * @param ParameterCount The amount of parameters, parameters beyond the argument's parameter count are ignored
+	 * @param Values The values to store the parsed parameters in, only written to if parsing succeeds
+	 * @param Position Set to the position the validator failed at
+	 * @param Instr The instrumentation policy, see ParseInstrumentation
+	 * @return ParseErrc MissingParameters if not enough parameters are passed and no implicit or default values are specified, 
+	 * ValidatorFailed if the passed parameter values do not pass the custom validator function, None otherwise
+	 */
+	template<typename Instrumentation>
+	ParseErrc _TryParseArg(const std::string_view* Parameters, std::size_t ParameterCount, ParsedValues& Values, std::size_t& Position, Instrumentation& Instr) const {
+		const std::uint16_t Flags = _Table->Flags[_index];
+		auto FlagSet = [Flags](ArgumentFlag Flag){return (Flags & static_cast<std::uint16_t>(Flag)) != 0;};
+		const bool needs_parameters = FlagSet(ArgumentFlag::NeedsParameters);
+		const bool has_implicitValues = FlagSet(ArgumentFlag::ImplicitValues);
+		const bool has_defaultValues = FlagSet(ArgumentFlag::DefaultValues);
+		const std::size_t ParamCount = this->ParamCount();
+		if(!needs_parameters){
+			typename Instrumentation::Timer ActionTimer(Instr, ParsePhase::Action);
+			_Extras->Action({}); // optimatisation for information arguments
+			Instr.ActionRun(*this);
+		}
+		ParameterCount = std::min(ParameterCount, ParamCount);
+		if(ParameterCount != ParamCount && !has_implicitValues && !has_defaultValues && !FlagSet(ArgumentFlag::Variadic)) // no default values and not enough parameters. Problem!
+			return ParseErrc::MissingParameters;
+		// Set up views of the correct parameter values
+		std::vector<std::string_view> tempParamViews(ParamCount);
+		if(ParamCount)
+			Instr.Allocated(1);
+		bool usesDefaultValues = false;
+		if(has_implicitValues)
+			FormatValues();
+		const std::string_view* ImplicitValues = _ParamStrings + 2 * ParamCount;
+		// If there are implicit values and no parameters given, use implicit values
+		if(has_implicitValues && ParameterCount == 0)
+			std::copy(ImplicitValues, ImplicitValues + ParamCount, tempParamViews.begin());
+		else{
+			std::copy(Parameters, Parameters + ParameterCount, tempParamViews.begin());
+			if(ParameterCount != ParamCount){ // Not all parameter values were passed
+				if(has_implicitValues) // we have implicit values through!
+					std::copy(ImplicitValues + ParameterCount, ImplicitValues + ParamCount, tempParamViews.begin() + ParameterCount);
+				else if(has_defaultValues){ // or we have default values though!
+					for(std::size_t i = ParameterCount; i < ParamCount; i++)
+						tempParamViews[i] = DefaultValueView(i);
+					usesDefaultValues = true;
+				}
+			}
+		}
+		const bool HasValidator = this->HasValidator();
+		const bool HasAction = needs_parameters && this->HasAction();
+		// The validator and action work on strings, only materialize them if either is set
+		std::vector<std::string> tempParamValues;
+		if(HasValidator || HasAction){
+			tempParamValues.assign(tempParamViews.begin(), tempParamViews.end());
+			if constexpr(Instrumentation::Enabled){
+				// the vector and every string too long for the small string buffer
+				const std::size_t SmallStringCapacity = std::string().capacity();
+				Instr.Allocated(1 + static_cast<std::size_t>(std::count_if(tempParamValues.begin(), tempParamValues.end(), 
+					[&](const std::string& Value){return Value.size() > SmallStringCapacity;})));
+			}
+		}
+
+		// If there is a validator, execute validator
+		if(HasValidator){
+			std::size_t pos;
+			{
+				typename Instrumentation::Timer ValidatorTimer(Instr, ParsePhase::Validator);
+				pos = _Extras->Validator(tempParamValues);
+			}
+			Instr.ValidatorRun(*this, pos);
+			if(pos){
+				Position = pos;
+				return ParseErrc::ValidatorFailed;
+			}
+		}
+
+		// Convert the values once so typed reads do not have to, a variadic argument may miss parameters
+		std::shared_ptr<const TypedValuesBase> tempTypedValues;
+		if(FlagSet(ArgumentFlag::Typed) && std::none_of(tempParamViews.begin(), tempParamViews.end(), [](std::string_view View){return View.data() == nullptr;})){
+			typename Instrumentation::Timer ConversionTimer(Instr, ParsePhase::Conversion);
+			tempTypedValues = _f_ConvertTyped(tempParamViews.data());
+			Instr.Converted(*this, ParamCount);
+			Instr.Allocated(1);
+		}
+
+		// If there is a custom parser, execute that instead
+		if(HasAction){
+			{
+				typename Instrumentation::Timer ActionTimer(Instr, ParsePhase::Action);
+				_Extras->Action(tempParamValues);
+			}
+			Instr.ActionRun(*this);
+		}
+		// Keep the views if everything went well, default values are read from the argument itself
+		if(usesDefaultValues)
+			std::fill(tempParamViews.begin() + ParameterCount, tempParamViews.end(), std::string_view());
+		Values.is_used = true;
+		Values.views.swap(tempParamViews);
+		Values.typed = std::move(tempTypedValues);
+		return ParseErrc::None;
+	}
+
+	/**
+	 * @brief Parses parameters given to the argument, see _TryParseArg
+	 * @throws out_of_range exception if not enough parameters are passed and no implicit or default values are specified.
+	 * @throws ValidatorException exception if the passed parameter values do not pass the custom validator function. Only applies if validator function is specified.
+	 */
+	template<typename Instrumentation>
+	void _ParseArg(const std::string_view* Parameters, std::size_t ParameterCount, ParsedValues& Values, Instrumentation& Instr) const {
+		std::size_t Position = 0;
+		switch(_TryParseArg(Parameters, ParameterCount, Values, Position, Instr)){
+		case ParseErrc::MissingParameters:
+			throw std::out_of_range(MissingParametersMessage());
+		case ParseErrc::ValidatorFailed:
+			throw ValidatorException(ValidatorMessage(Position), std::string(Callees[0]), Position);
+		default:
+			break;
+		}
+	}
+
+	std::string MissingParametersMessage() const {
+		std::stringstream exception_error;
+		exception_error << "Not enough parameters for argument: " << Callees[0] << " default usage: \n\t";
+		exception_error << GetCalleeFormatted() << " ";
+		if(!Has(ArgumentFlag::ImplicitValues))	// don't print default values if there is an implicit value
+			FormatParameters(exception_error);
+		else
+			exception_error << std::endl;
+		return exception_error.str();
+	}
+
+	std::string ValidatorMessage(std::size_t Position) const {
+		return "Validator for argument: " + std::string(Callees[0]) + " failed at position " + std::to_string(Position);
+	}
+
+	// Converts the default values to typed storage so they can be read before or without the argument being passed
+	void UpdateTypedDefaults(){
+		if(Has(ArgumentFlag::Typed) && Has(ArgumentFlag::DefaultValues)){
+			std::vector<std::string_view> DefaultViews(ParamCount());
+			for(std::size_t i = 0; i < DefaultViews.size(); i++)
+				DefaultViews[i] = DefaultValueView(i);
+			MutableExtras().TypedDefaults = _f_ConvertTyped(DefaultViews.data());
+		}
+	}
+
+	//?==== Value access shared by Argument and ParsedArgument ====?//
+
+	// Gets a view of the value of the parameter at idx
+	std::string_view ParamView(const ParsedValues& Values, std::size_t idx) const {
+		if(!Values.owned.empty())
+			return Values.owned[idx];
+		return idx < Values.views.size() && Values.views[idx].data() ? Values.views[idx] : DefaultValueView(idx);
+	}
+
+	std::string_view CheckedParamView(const ParsedValues& Values, std::size_t idx) const {
+		if(idx >= ParamCount())
+			throw std::out_of_range("Argument " + std::string(Callees[0]) + "'s parameter "  + std::to_string(idx) + " is out of range!");
+		return ParamView(Values, idx);
+	}
+
+	template<typename T> T ParseValue(const ParsedValues& Values, std::size_t idx) const {
+		if(idx >= ParamCount())
+			throw std::out_of_range("Argument " + std::string(Callees[0]) + "'s parameter "  + std::to_string(idx) + " is out of range!");
+		if(Values.owned.empty()){ // values changed through operator[] are only stored as strings
+			if(const TypedValuesBase* Typed = Values.typed ? Values.typed.get() : TypedDefaults())
+				if(const void* value = Typed->Get(idx, typeid(T)))
+					return *static_cast<const T*>(value);
+			// default values kept in their type are read without formatting and converting them
+			if(_DefaultValues && !(idx < Values.views.size() && Values.views[idx].data()))
+				if(const void* value = _DefaultValues->Get(idx, typeid(T)))
+					return *static_cast<const T*>(value);
+		}
+		const std::string_view value = ParamView(Values, idx);
+		if(value.empty())
+			throw std::out_of_range("Argument " + std::string(Callees[0]) + "'s parameter "  + std::to_string(idx) + " was not set!");
+		return ToType<T>(value);
+	}
+
+	template<typename T> const T& TypedValue(const ParsedValues& Values, std::size_t idx) const {
+		if(idx >= ParamCount())
+			throw std::out_of_range("Argument " + std::string(Callees[0]) + "'s parameter "  + std::to_string(idx) + " is out of range!");
+		if(!Values.owned.empty())
+			throw std::logic_error("Argument " + std::string(Callees[0]) + " has no typed values, its values were changed through operator[]");
+		const TypedValuesBase* Typed = Values.typed ? Values.typed.get() : TypedDefaults();
+		if(!Typed)
+			throw std::logic_error("Argument " + std::string(Callees[0]) + " has no typed values, enable them with Typed() and pass or default the argument");
+		const void* value = Typed->Get(idx, typeid(T));
+		if(!value)
+			throw std::logic_error("Argument " + std::string(Callees[0]) + "'s parameter " + std::to_string(idx) + " is not of type " + cached_type_name<T>());
+		return *static_cast<const T*>(value);
+	}
+
+	// Init parameter names based on variadic list, this creates default param names
+	template<std::size_t I = 0, typename ...ParamTypes>
+	inline typename std::enable_if<I  < sizeof...(ParamTypes), void>::type InitParamNamesDefault(){
+		using Name = decltype(ParameterTypeName<TupleTypeAt<I, ParamTypes...>>());
+		if constexpr(std::is_same<Name, std::string_view>::value) // names known at compile time are static, viewed without copying
+			_ParamStrings[I] = ParameterTypeName<TupleTypeAt<I, ParamTypes...>>();
+		else
+			_ParamStrings[I] = _Table->Strings.Intern(ParameterTypeName<TupleTypeAt<I, ParamTypes...>>());
+		InitParamNamesDefault<I+1, ParamTypes...>();
+	}
+	// SFINAE
+	template<std::size_t I = 0, typename ...ParamTypes>
+	inline typename std::enable_if<I == sizeof...(ParamTypes), void>::type InitParamNamesDefault(){}
+
+	// Init implicit values based on variadic list
+	template<std::size_t I = 0, typename ...ParamTypes>
+	typename std::enable_if<I  < sizeof...(ParamTypes), void>::type implicit_value(std::tuple<ParamTypes...> t){
+		_ParamStrings[2 * ParamCount() + I] = InternValue("Implicit", I, std::get<I>(t));
+		implicit_value<I+1, ParamTypes...>(t);
+	}
+	//SFINAE
+	template<std::size_t I = 0, typename ...ParamTypes>
+	typename std::enable_if<I == sizeof...(ParamTypes), void>::type implicit_value(std::tuple<ParamTypes...> t){(void)(t);}
+
+	// Init default values based on variadic list
+	template<std::size_t I = 0, typename ...ParamTypes>
+	typename std::enable_if<I  < sizeof...(ParamTypes), void>::type default_value(std::tuple<ParamTypes...> t){
+		SetDefaultValue(I, InternValue("Default", I, std::get<I>(t)));
+		default_value<I+1, ParamTypes...>(t);
+	}
+	//SFINAE end condition
+	template<std::size_t I = 0, typename ...ParamTypes>
+	typename std::enable_if<I == sizeof...(ParamTypes), void>::type default_value(std::tuple<ParamTypes...> t){(void)(t);}
+
+	// Init parameter names based on variadic list
+	template<std::size_t I = 0, typename ...ParamTypes>
+	typename std::enable_if<I  < sizeof...(ParamTypes), void>::type parameter_name(std::tuple<ParamTypes...> t){
+		_ParamStrings[I] = _Table->Strings.Intern(std::get<I>(t));
+		parameter_name<I+1, ParamTypes...>(t);
+	}
+	//SFINAE
+	template<std::size_t I = 0, typename ...ParamTypes>
+	typename std::enable_if<I == sizeof...(ParamTypes), void>::type parameter_name(std::tuple<ParamTypes...> t){(void)(t);}
+
+public:
+	
+	/**
+	 * @brief Construct a new Argument object, adding its row to a table. Arguments are added through ArgumentParser::addArgument
+	 * 
+	 * @param Table The table of the parser the argument belongs to
+	 * @param paramcount The amount of parameters this argument will use
+	 * @param ArgName First Possible Argument Callee, Single character prefix with -, multi character prefix with --
+	 * @param ArgName2 Second Possible Argument Callee, Single character prefix with -, multi character prefix with --
+	 */
+	Argument(ArgumentTable& Table, std::size_t paramcount, std::string_view ArgName, std::string_view ArgName2 = {}) 
+		: _Table(&Table), _index(static_cast<std::uint32_t>(Table.Add(paramcount))), 
+		  Callees{Table.Strings.Intern(ArgName), ArgName2.empty() ? std::string_view() : Table.Strings.Intern(ArgName2)}, 
+		  _ParamStrings(Table.Strings.Views(3 * paramcount)) {}
+
+	// An argument is a row of the table of its parser, a copy would share the row. Refer to arguments by reference, e.g. Argument& A = AP["-x"];
+	Argument(const Argument&) = delete;
+	Argument& operator=(const Argument&) = delete;
+
+	/**
+	 * @brief Sets the name per parameter
+	 * 
+	 * @tparam ParamTypes list of parameter types
+	 * @param ParameterNames String names of the parameters
+	 * @return Argument& The argument reference
+	 */
+	template<typename ...ParamTypes>
+	Argument& ParameterName(ParamTypes... ParameterNames){
+		CheckValueCount(sizeof...(ParamTypes));
+		parameter_name<0, ParamTypes...>(std::tuple<ParamTypes...>(ParameterNames...));
+		_revision++;
+		return *this;
+	}
+
+	/**
+	 * @brief Sets the default value per paramater
+	 * Default values for the argument. If the argument is not passed these values are used.
+	 * Values of trivially destructible types are kept as they are and only formatted once help shows them or they are read as strings, 
+	 * Parse reads them without any conversion if it is passed the type of the value.
+	 * @tparam ParamTypes list of parameter types
+	 * @param defaultValues Default value per parameter
+	 * @return Argument& The argument reference
+	 */
+	template<typename ...ParamTypes>
+	Argument& DefaultValue(ParamTypes... defaultValues){
+		CheckValueCount(sizeof...(ParamTypes));
+		// values changed through operator[] are strings, the new values replace them as strings too
+		_DefaultValues = ChangedDefaults() ? nullptr : StoreValues("Default", std::index_sequence_for<ParamTypes...>{}, defaultValues...);
+		if(!_DefaultValues)
+			default_value<0, ParamTypes...>(std::tuple<ParamTypes...>(defaultValues...));
+		Set(ArgumentFlag::DefaultValues);
+		UpdateTypedDefaults();
+		_revision++;
+		return *this;
+	}
+
+	/**
+	 * @brief Sets the implicit value per parameter
+	 * Implicit values are values used if the argument is passed but no parameters are passed
+	 * @tparam ParamTypes list of parameter types
+	 * @param implicitValues Implicit value per parameter
+	 * @return Argument& The argument reference
+	 */
+	template<typename ...ParamTypes>
+	Argument& ImplicitValue(ParamTypes... implicitValues){
+		CheckValueCount(sizeof...(ParamTypes));
+		_ImplicitValues = StoreValues("Implicit", std::index_sequence_for<ParamTypes...>{}, implicitValues...);
+		if(!_ImplicitValues)
+			implicit_value<0, ParamTypes...>(std::tuple<ParamTypes...>(implicitValues...));
+		Set(ArgumentFlag::ImplicitValues);
+		_revision++;
+		return *this;
+	}
+
+	/**
+	 * @brief Sets the help message for the argument
+	 * 
+	 * @param help the help message string
+	 * @return Argument& The argument reference
+	 */
+	Argument& Help(std::string_view help) {helpString = _Table->Strings.Intern(help); _revision++; return *this;}
+	/**
+	 * @brief Sets the argument as required
+	 * If the argument is required but not passed an error is thrown during parsing
+	 * @return Argument& The argument reference
+	 */
+	Argument& Required();
+
+	/**
+	 * @brief Sets the parse always property
+	 * If an argument is set to be always parsed then even if not all required arguments are passed this argument will still be parsed.
+	 * @return Argument& The argument reference
+	 */
+	Argument& ParseAlways(){Set(ArgumentFlag::ParseAlways); return *this;}
+
+	/**
+	 * @brief Lets the argument take any amount of parameters, including none
+	 * Every following token up to the next argument is a value of the argument, they are read through Values().
+	 * The first values are also its parameters, parameters that are not passed use the implicit or default values if set and are unset otherwise.
+	 * @return Argument& The argument reference
+	 */
+	Argument& Variadic(){Set(ArgumentFlag::Variadic); _revision++; return *this;}
+
+	/**
+	 * @brief Lets the argument be passed more than once, as in -I a -I b
+	 * The parameters of every occurrence are collected and read through Values(). Parse and View read the parameters of the first occurrence.
+	 * @return Argument& The argument reference
+	 */
+	Argument& Repeatable(){Set(ArgumentFlag::Repeatable); return *this;}
+
+	/**
+	 * @brief Parses the argument after another argument of the same priority, once the validator and action of that argument completed
+	 * Orders the arguments of a priority in serial and concurrent parsing alike, see ArgumentParser::ConcurrentActions.
+	 * The dependency is ignored if the other argument is not passed, depending on an argument of lower priority throws a logic_error when parsing.
+	 * @param Callee A callee of the argument to depend on
+	 * @return Argument& The argument reference
+	 * @throws invalid_argument exception if the argument does not exist or is this argument
+	 */
+	Argument& DependsOn(std::string_view Callee);
+
+	/**
 	 * @brief Sets a custom argument parser function. 
 	 * Gets called when the argument is being parsed instead of the default parser. Has access to the parameter vector that would normally be parsed for the argument.
 	 * @param Action The function of the custom argument parser
 	 * @param needs_parameters if the action does not need any parameters, for example information flags, then this can be set to false to execute the action function before parsing, giving slight performance improvements
 	 * @return Argument& The argument reference
 	 */
-	Argument& Action(std::function<void(const std::vector<std::string>&)> Action, bool needs_parameters = true){
-		this->needs_parameters = needs_parameters;
-		_f_ArgumentAction = Action;
+	Argument& Action(std::function<void(const std::vector<std::string>&)> Action, bool needs_parameters = true){
+		Set(ArgumentFlag::NeedsParameters, needs_parameters);
+		MutableExtras().Action = Action;
+		return *this;
+	}
+	
+	/**
+	 * @brief Sets a custom validator function. 
+	 * Gets called at the beginning of an arguments parsing function. Should return 0 if validation is passed otherwise the position of the argument that did not pass the validator check
+	 * @param Validator The function of the custom validator
+	 * @return Argument& The argument reference
+	 */
+	Argument& Validator(std::function<std::size_t(const std::vector<std::string>&)> Validator){
+		MutableExtras().Validator = Validator;
+		return *this;
+	}
+
+	/**
+	 * @brief Sets the priority of the argument
+	 * Arguments can be sorted by priority, A higher priority means it will be handled before lower priority arguments.
+	 * Same level priority arguments are sorted based on input
+	 * @param priority The priority of the argument
+	 * @return Argument& The argument reference
+	 */
+	Argument& priority(std::size_t priority){
+		_Table->Priorities[_index] = priority;
+		return *this;
+	}
+
+	/**
+	 * @brief Enables typed storage for the argument
+	 * The parameter values are converted to the types the argument was added with once while parsing, 
+	 * after which Value<T>() and Parse<T>() read them without any conversion or allocation.
+	 * A failed conversion throws an invalid_argument exception during parsing instead of on access.
+	 * @return Argument& The argument reference
+	 */
+	Argument& Typed(){
+		Set(ArgumentFlag::Typed);
+		UpdateTypedDefaults();
+		return *this;
+	}
+
+	/**
+	 * @brief Gets a string value reference of the parameter based on idx
+	 * If the argument was passed, the reference is to the parsed value, a change lasts until the next parse. 
+	 * Otherwise the reference is to the default value, a change is used by later parses and shown in the help.
+	 * @param idx The position of the parameter in the list
+	 * @return std::string& A reference to the parameter string value
+	 */
+	std::string& operator[](std::size_t idx) {
+		if(_Values.is_used){
+			if(_Values.owned.empty()){ // copy the parsed values, they are reset by the next parse
+				std::vector<std::string> Owned;
+				for(std::size_t i = 0; i < ParamCount(); i++)
+					Owned.emplace_back(ParamView(_Values, i));
+				_Values.owned = std::move(Owned);
+				_Values.typed = nullptr; // the typed values no longer match once the values are changed
+			}
+			return _Values.owned[idx];
+		}
+		if(!ChangedDefaults()){ // the interned default values can not be changed, copy them
+			FormatValues();
+			_DefaultValues = nullptr; // the typed values no longer match the defaults once they are changed
+			for(std::size_t i = 0; i < ParamCount(); i++)
+				MutableExtras().Values.emplace_back(_ParamStrings[ParamCount() + i]);
+		}
+		_revision++; // the returned value may be changed and is shown as default value in the help
+		return _Extras->Values[idx];
+	}
+	/**
+	 * @brief Gets a string value of the parameter based on idx 
+	 * 
+	 * @param idx The position of the parameter in the list
+	 * @return std::string The string value of the parameter
+	 */
+	std::string  operator[](std::size_t idx) const {return std::string(ParamView(_Values, idx));}
+
+	/**
+	 * @brief Gets a view of the parameter value based on idx without copying it
+	 * Parsed values view the tokens passed to ArgumentParser::ParseArguments
+	 * @param idx The position of the parameter in the list
+	 * @return std::string_view A view of the parameter value
+	 * @throws out_of_range exception if idx is bigger or equal to the size of the parameter list
+	 */
+	std::string_view View(std::size_t idx) const {return CheckedParamView(_Values, idx);}
+
+	/**
+	 * @brief Parses the parameter value to the given type based on T
+	 * 
+	 * @tparam T The type to parse the string to
+	 * @param idx the position of the parameter to parse
+	 * @return T The parsed value
+	 * @throws out_of_range exception if idx is bigger or equal to the size of the parameter list
+	 * @throws out_of_range exception if stored parameter value is an empty string.
+	 */
+	template<typename T> T Parse(std::size_t idx) const {return ParseValue<T>(_Values, idx);}
+
+	/**
+	 * @brief Gets the typed value of the parameter based on idx without any conversion
+	 * Requires typed storage, see Typed().
+	 * @tparam T The type the parameter was declared with in addArgument
+	 * @param idx the position of the parameter
+	 * @return const T& A reference to the stored value
+	 * @throws out_of_range exception if idx is bigger or equal to the size of the parameter list
+	 * @throws logic_error exception if typed storage is not enabled, no value is stored yet or T is not the declared type
+	 */
+	template<typename T> const T& Value(std::size_t idx) const {return TypedValue<T>(_Values, idx);}
+
+	/**
+	 * @brief Gets every value of a variadic or repeatable argument, see Variadic() and Repeatable()
+	 * The values are read from the parsed tokens while iterating, without copying them. Empty for other arguments.
+	 * @return const TokenRange& The values in the order they were passed
+	 */
+	const TokenRange& Values() const {return _ValueRange;}
+
+	/**
+	 * @brief Boolean check for if the argument was used in the function call.
+	 * 
+	 * @return true The argument was used
+	 * @return false The argument was not used
+	 */
+	bool IsUsed() const {
+		return _Values.is_used;
+	}
+
+	/**
+	 * @brief Print Argument to an ostream
+	 * 
+	 * @param os output stream object
+	 * @param ArgBase The argument to print to the output stream object
+	 * @return std::ostream& The output stream reference
+	 */
+	friend std::ostream& operator<<(std::ostream& os, const Argument& ArgBase){
+		std::string Out;
+		ArgBase.RenderHelp(Out, CalleeLengthBeforeDescription, 0);
+		return os.write(Out.data(), static_cast<std::streamsize>(Out.size()));
+	}
+	
+	/**
+	 * @brief Checks if the given string callee matches with any of this argument
+	 * 
+	 * @param callee The callee to check
+	 * @return true This argument contains this callee
+	 * @return false This argument does not contain this callee
+	 */
+	bool operator==(const std::string& callee) const {
+		return Callees[0] == callee || (!Callees[1].empty() && Callees[1] == callee);
+	}
+};
+
+/**
+ * @brief Read only access to the values a single parse produced for an argument
+ * Offers the same accessors as Argument. Only valid as long as the ParseResult it was taken from.
+ */
+class ParsedArgument {
+	const Argument& _Argument;
+	const ParsedValues& _Values;
+	const TokenRange& _ValueRange;
+
+public:
+	ParsedArgument(const Argument& _Argument, const ParsedValues& _Values, const TokenRange& _ValueRange) 
+		: _Argument(_Argument), _Values(_Values), _ValueRange(_ValueRange) {}
+
+	/**
+	 * @brief Gets a string value of the parameter based on idx 
+	 * 
+	 * @param idx The position of the parameter in the list
+	 * @return std::string The string value of the parameter
+	 */
+	std::string operator[](std::size_t idx) const {return std::string(_Argument.ParamView(_Values, idx));}
+
+	/**
+	 * @brief Gets a view of the parameter value based on idx without copying it
+	 * 
+	 * @param idx The position of the parameter in the list
+	 * @return std::string_view A view of the parameter value
+	 * @throws out_of_range exception if idx is bigger or equal to the size of the parameter list
+	 */
+	std::string_view View(std::size_t idx) const {return _Argument.CheckedParamView(_Values, idx);}
+
+	/**
+	 * @brief Parses the parameter value to the given type based on T, see Argument::Parse
+	 */
+	template<typename T> T Parse(std::size_t idx) const {return _Argument.ParseValue<T>(_Values, idx);}
+
+	/**
+	 * @brief Gets the typed value of the parameter based on idx without any conversion, see Argument::Value
+	 */
+	template<typename T> const T& Value(std::size_t idx) const {return _Argument.TypedValue<T>(_Values, idx);}
+
+	/**
+	 * @brief Gets every value of a variadic or repeatable argument, see Argument::Values
+	 */
+	const TokenRange& Values() const {return _ValueRange;}
+
+	/**
+	 * @brief Boolean check for if the argument was used in the parsed command line.
+	 * 
+	 * @return true The argument was used
+	 * @return false The argument was not used
+	 */
+	bool IsUsed() const {return _Values.is_used;}
+};
+
+// Keeps response files and unescaped tokens alive for the values viewing them
+struct TokenStorage {
+	std::vector<std::shared_ptr<const MappedFile>> Files;
+	std::vector<std::unique_ptr<char[]>> Tokens;
+
+	void clear(){
+		Files.clear();
+		Tokens.clear();
+	}
+};
+
+// The parameters of config files and environment variables and the storage they view, shared by everything viewing them so they outlive ArgumentParser::ReloadSources
+struct SourceTokens {
+	TokenStorage Storage;
+	std::vector<std::string_view> Parameters;
+};
+
+/**
+ * @brief The values of all arguments produced by a single ArgumentParser::Parse call
+ * Parameter values view the parsed tokens, these and the parser should outlive the result.
+ */
+class ParseResult {
+	friend class ArgumentParser;
+	friend class BatchParser;
+	template<typename> friend class IncrementalParser;
+
+	const ArgumentParser* Parser;
+	// Values of the parsed arguments only, keyed by the position the argument was added at. 
+	// Sorted by Finalize, before that in parse order possibly containing an argument more than once
+	std::vector<std::pair<std::size_t, ParsedValues>> Values;
+	// Response files and unescaped tokens viewed by the values
+	TokenStorage Storage;
+	// Config and environment values viewed by the values, only set if any argument got its value from them
+	std::shared_ptr<const SourceTokens> Sources;
+	// Every value of the passed variadic and repeatable arguments, keyed by the position the argument was added at
+	std::vector<std::pair<std::size_t, TokenRange>> ValueRanges;
+	// Tokens that are not an argument or one of its parameters
+	TokenRange _Operands;
+	// The passed subcommand and the values of its arguments, see ArgumentParser::AddSubcommand
+	std::string_view _SubcommandName;
+	std::unique_ptr<ParseResult> _Subcommand;
+
+	explicit ParseResult(const ArgumentParser& Parser) : Parser(&Parser) {}
+
+	// Adds an entry for the values of an argument, only valid until the next call
+	ParsedValues& Add(std::size_t index){
+		Values.emplace_back(index, ParsedValues());
+		return Values.back().second;
+	}
+
+	// Sorts the values by argument, of an argument parsed more than once the last values are kept
+	void Finalize(){
+		std::stable_sort(Values.begin(), Values.end(), [](const auto& A, const auto& B){return A.first < B.first;});
+		auto Last = std::unique(Values.rbegin(), Values.rend(), [](const auto& A, const auto& B){return A.first == B.first;});
+		Values.erase(Values.begin(), Last.base());
+		if(_Subcommand)
+			_Subcommand->Finalize();
+	}
+
+	// Gets the value range of an argument, added on first use
+	TokenRange& AddRange(std::size_t index){
+		for(auto& Entry : ValueRanges)
+			if(Entry.first == index)
+				return Entry.second;
+		ValueRanges.emplace_back(index, TokenRange());
+		return ValueRanges.back().second;
+	}
+
+	// Gets the value range of an argument, arguments without values share an empty range
+	const TokenRange& GetRange(std::size_t index) const {
+		static const TokenRange Empty;
+		for(const auto& Entry : ValueRanges)
+			if(Entry.first == index)
+				return Entry.second;
+		return Empty;
+	}
+
+	// Returns true if any range views the parsed tokens
+	bool HasRanges() const {return !ValueRanges.empty() || !_Operands.empty() || (_Subcommand && _Subcommand->HasRanges());}
+
+	// Gets the values of an argument, unused arguments share an empty entry
+	const ParsedValues& Get(std::size_t index) const {
+		static const ParsedValues Unused;
+		auto it = std::lower_bound(Values.begin(), Values.end(), index, [](const auto& A, std::size_t index){return A.first < index;});
+		return it != Values.end() && it->first == index ? it->second : Unused;
+	}
+
+public:
+	/**
+	 * @brief Returns the values of an argument specified by the key
+	 * 
+	 * @param ArgKey Any callee of the argument
+	 * @return ParsedArgument The values of the argument
+	 * @throws invalid_argument exception if the argument key does not exist
+	 */
+	ParsedArgument operator[](std::string_view ArgKey) const;
+
+	/**
+	 * @brief Gets the operands, the tokens that are not an argument or one of its parameters
+	 * A token is an operand if it comes before the first argument or follows all parameters of an argument, as file.txt in -I 1 file.txt.
+	 * @return const TokenRange& The operands in the order they were passed, read from the parsed tokens while iterating
+	 */
+	const TokenRange& Operands() const {return _Operands;}
+
+	/**
+	 * @brief Gets the name of the passed subcommand, see ArgumentParser::AddSubcommand
+	 * @return std::string_view The name, empty if no subcommand was passed
+	 */
+	std::string_view Subcommand() const {return _SubcommandName;}
+
+	/**
+	 * @brief Gets the values of the arguments of the passed subcommand
+	 * @return const ParseResult& The values, read like those of the parser
+	 * @throws logic_error exception if no subcommand was passed
+	 */
+	const ParseResult& SubcommandResult() const {
+		if(!_Subcommand)
+			throw std::logic_error("No subcommand was passed");
+		return *_Subcommand;
+	}
+};
+
+//?==== Command line tokenizer ====?//
+
+/**
+ * @brief Checks if a token is an argument callee rather than a parameter
+ * Arguments start with - followed by anything but a digit, so negative numbers are parameters
+ */
+inline bool IsArgumentToken(std::string_view Token){
+	return (Token.size() == 2 && Token[0] == '-' && Token[1] != '-' && !std::isdigit(static_cast<unsigned char>(Token[1]))) 
+		|| (Token.size() > 2 && Token[0] == '-' && !std::isdigit(static_cast<unsigned char>(Token[1])));
+}
+
+/**
+ * @brief Classifies a whole buffer of tokens at once
+ * 
+ * @param Tokens The tokens to classify
+ * @return std::vector<bool> For every token whether it is an argument callee
+ */
+inline std::vector<bool> ClassifyTokens(const std::vector<std::string_view>& Tokens){
+	std::vector<bool> IsArgument(Tokens.size());
+	for(std::size_t i = 0; i < Tokens.size(); i++)
+		IsArgument[i] = IsArgumentToken(Tokens[i]);
+	return IsArgument;
+}
+
+inline bool IsShellWhitespace(char c){return c == ' ' || (c >= '\t' && c <= '\r');}
+
+// Finds the bytes the tokenizer stops at one byte at a time
+struct ScalarScan {
+	// Finds the first whitespace, quote or backslash
+	static const char* Unquoted(const char* p, const char* end){
+		while(p != end && !IsShellWhitespace(*p) && *p != '\'' && *p != '"' && *p != '\\')
+			p++;
+		return p;
+	}
+	// Finds the first double quote or backslash
+	static const char* DoubleQuoted(const char* p, const char* end){
+		while(p != end && *p != '"' && *p != '\\')
+			p++;
+		return p;
+	}
+	// Finds the first single quote
+	static const char* SingleQuoted(const char* p, const char* end){
+		while(p != end && *p != '\'')
+			p++;
+		return p;
+	}
+};
+
+#if defined(ARGPAR_SSE2_TOKENIZER)
+// Finds the bytes the tokenizer stops at 16 bytes at a time, the tail is scanned by ScalarScan
+struct SSE2Scan {
+	static const char* Unquoted(const char* p, const char* end){
+		const __m128i Space = _mm_set1_epi8(' '), Single = _mm_set1_epi8('\''), Double = _mm_set1_epi8('"'), Backslash = _mm_set1_epi8('\\');
+		const __m128i BelowTab = _mm_set1_epi8('\t' - 1), AboveReturn = _mm_set1_epi8('\r' + 1);
+		for(; end - p >= 16; p += 16){
+			const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+			__m128i match = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(x, Space), _mm_cmpeq_epi8(x, Single)), 
+										 _mm_or_si128(_mm_cmpeq_epi8(x, Double), _mm_cmpeq_epi8(x, Backslash)));
+			// \t, \n, \v, \f and \r are consecutive
+			match = _mm_or_si128(match, _mm_and_si128(_mm_cmpgt_epi8(x, BelowTab), _mm_cmplt_epi8(x, AboveReturn)));
+			if(const int mask = _mm_movemask_epi8(match))
+				return p + __builtin_ctz(static_cast<unsigned>(mask));
+		}
+		return ScalarScan::Unquoted(p, end);
+	}
+	static const char* DoubleQuoted(const char* p, const char* end){
+		const __m128i Double = _mm_set1_epi8('"'), Backslash = _mm_set1_epi8('\\');
+		for(; end - p >= 16; p += 16){
+			const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+			if(const int mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(x, Double), _mm_cmpeq_epi8(x, Backslash))))
+				return p + __builtin_ctz(static_cast<unsigned>(mask));
+		}
+		return ScalarScan::DoubleQuoted(p, end);
+	}
+	static const char* SingleQuoted(const char* p, const char* end){
+		const __m128i Single = _mm_set1_epi8('\'');
+		for(; end - p >= 16; p += 16){
+			const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+			if(const int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(x, Single)))
+				return p + __builtin_ctz(static_cast<unsigned>(mask));
+		}
+		return ScalarScan::SingleQuoted(p, end);
+	}
+};
+using DefaultScan = SSE2Scan;
+#else
+using DefaultScan = ScalarScan;
+#endif
+
+// Writes unescaped tokens into a buffer the size of the command line, which is allocated on first use. The tokens stay valid as long as the buffer
+struct BufferedUnescape {
+	std::unique_ptr<char[]>& Storage;
+	std::size_t Capacity; // unescaped tokens never grow, so the buffer never needs more than the command line size
+	char* out = nullptr;
+	char* start = nullptr;
+
+	BufferedUnescape(std::unique_ptr<char[]>& Storage, std::size_t Capacity) : Storage(Storage), Capacity(Capacity) {}
+
+	// Starts a token with the part before the first quote or escape
+	void Begin(const char* Token, std::size_t Length){
+		if(!out){
+			// a buffer passed in may be smaller than this command line, always allocate one that fits
+			Storage.reset(new char[Capacity]);
+			out = Storage.get();
+		}
+		start = out;
+		Append(Token, Length);
+	}
+	void Append(const char* p, std::size_t Length){
+		std::memcpy(out, p, Length);
+		out += Length;
+	}
+	void Push(char c){*out++ = c;}
+	std::string_view Finish() const {return std::string_view(start, out - start);}
+};
+
+/**
+ * @brief Reads the next token of a command line following POSIX shell quoting rules, see Tokenize
+ * @tparam Scan The byte scanner to use
+ * @tparam Unescape Where tokens with quotes or escapes are written to, BufferedUnescape or TransientUnescape
+ * @param p The read position, advanced past the token
+ * @param end The end of the command line
+ * @param Out Receives the unescaped token if it contains quotes or escapes
+ * @param Token Receives the token, a view of the command line if it contains no quotes or escapes
+ * @return true if a token was read, false if only whitespace was left
+ * @throws invalid_argument exception if a quote is not closed or the command line ends with a backslash
+ */
+template<typename Scan, typename Unescape>
+bool ReadToken(const char*& p, const char* const end, Unescape& Out, std::string_view& Token){
+	auto Unterminated = [](const char* what){
+		throw std::invalid_argument(std::string("Command line ends within ") + what);
+	};
+
+	while(p != end && IsShellWhitespace(*p))
+		p++;
+	if(p == end)
+		return false;
+	const char* const start = p;
+	bool unescaped = false; // set once the token needs unescaping
+	while(true){
+		const char* special = Scan::Unquoted(p, end);
+		if(unescaped)
+			Out.Append(p, special - p);
+		p = special;
+		if(p == end || IsShellWhitespace(*p))
+			break;
+		// A quote or backslash, continue the token in Out
+		if(!unescaped){
+			Out.Begin(start, p - start);
+			unescaped = true;
+		}
+		if(*p == '\\'){
+			if(p + 1 == end)
+				Unterminated("an escape");
+			if(p[1] != '\n') // backslash newline continues the line
+				Out.Push(p[1]);
+			p += 2;
+		}
+		else if(*p == '\''){
+			const char* close = Scan::SingleQuoted(p + 1, end);
+			if(close == end)
+				Unterminated("single quotes");
+			Out.Append(p + 1, close - p - 1);
+			p = close + 1;
+		}
+		else{ // double quote
+			p++;
+			while(true){
+				const char* q = Scan::DoubleQuoted(p, end);
+				if(q == end)
+					Unterminated("double quotes");
+				Out.Append(p, q - p);
+				if(*q == '"'){
+					p = q + 1;
+					break;
+				}
+				if(q + 1 == end)
+					Unterminated("double quotes");
+				const char escaped = q[1];
+				if(escaped == '$' || escaped == '`' || escaped == '"' || escaped == '\\')
+					Out.Push(escaped);
+				else if(escaped != '\n'){ // other characters keep their backslash
+					Out.Push('\\');
+					Out.Push(escaped);
+				}
+				p = q + 2;
+			}
+		}
+	}
+	Token = unescaped ? Out.Finish() : std::string_view(start, p - start);
+	return true;
+}
+
+/**
+ * @brief Splits a command line into tokens following POSIX shell quoting rules
+ * Tokens are separated by whitespace. Outside of quotes a backslash escapes the next character, 
+ * within single quotes every character is literal and within double quotes a backslash only escapes $ ` " \ and newlines.
+ * Tokens without quotes or escapes view CommandLine, the others view Storage, which is only allocated if needed.
+ * @tparam Scan The byte scanner to use, DefaultScan is vectorized if the target supports it
+ * @param CommandLine The command line to split, should outlive the tokens
+ * @param Tokens Receives the tokens, cleared first
+ * @param Storage Receives the buffer the unescaped tokens are written to, should outlive the tokens. A buffer of a previous call is replaced
+ * @throws invalid_argument exception if a quote is not closed or the command line ends with a backslash
+ */
+template<typename Scan = DefaultScan>
+void Tokenize(std::string_view CommandLine, std::vector<std::string_view>& Tokens, std::unique_ptr<char[]>& Storage){
+	Tokens.clear();
+	const char* p = CommandLine.data();
+	const char* const end = p + CommandLine.size();
+	BufferedUnescape Out(Storage, CommandLine.size());
+	std::string_view Token;
+	while(ReadToken<Scan>(p, end, Out, Token))
+		Tokens.push_back(Token);
+}
+
+/**
+ * @brief A command line split into tokens, owns the unescaped tokens
+ * Tokens without quotes or escapes view the original command line, which should outlive this object.
+ */
+class TokenizedCommandLine {
+	std::unique_ptr<char[]> Storage;
+	std::vector<std::string_view> _Tokens;
+
+public:
+	/**
+	 * @brief Splits a command line into tokens, see Tokenize
+	 * @throws invalid_argument exception if a quote is not closed or the command line ends with a backslash
+	 */
+	explicit TokenizedCommandLine(std::string_view CommandLine){
+		Tokenize(CommandLine, _Tokens, Storage);
+	}
+
+	const std::vector<std::string_view>& Tokens() const {return _Tokens;}
+	std::size_t size() const {return _Tokens.size();}
+	std::string_view operator[](std::size_t idx) const {return _Tokens[idx];}
+};
+
+inline void TokenRange::iterator::Read(){
+	while(run != last && pos == run->count){
+		++run;
+		pos = 0;
+		p = nullptr;
+	}
+	if(run == last)
+		return;
+	InBuffer = false;
+	switch(run->kind){
+	case Run::Strings:
+		Token = static_cast<const char* const*>(run->first)[pos];
+		break;
+	case Run::Views:
+		Token = static_cast<const std::string_view*>(run->first)[pos];
+		break;
+	case Run::Text:{
+		const char* const text = static_cast<const char*>(run->first);
+		if(!p)
+			p = text;
+		ReadToken<DefaultScan>(p, text + run->bytes, Unescaped, Token); // the text was split while parsing, so it can not fail
+		InBuffer = Token.data() == Unescaped.Buffer.data();
+		break;
+	}
+	}
+}
+
+//?==== Response files ====?//
+
+/**
+ * @brief A read only view of a whole file, memory mapped where supported
+ * Pages that were read can be released again with Release, the data stays valid as it is read back from the file on access.
+ */
+class MappedFile {
+	const char* Data = nullptr;
+	std::size_t Size = 0;
+#ifdef ARGPAR_POSIX
+	bool Mapped = false;
+#else
+	std::unique_ptr<char[]> Buffer;
+#endif
+
+public:
+	/**
+	 * @brief Maps a file
+	 * @param Path The path of the file
+	 * @throws invalid_argument exception if the file can not be opened or read
+	 */
+	explicit MappedFile(const std::string& Path){
+#ifdef ARGPAR_POSIX
+		const int fd = ::open(Path.c_str(), O_RDONLY | O_CLOEXEC);
+		struct stat Info;
+		if(fd < 0 || ::fstat(fd, &Info) != 0){
+			if(fd >= 0)
+				::close(fd);
+			throw std::invalid_argument("Cannot open response file " + Path);
+		}
+		Size = static_cast<std::size_t>(Info.st_size);
+		if(Size){
+			void* Mapping = ::mmap(nullptr, Size, PROT_READ, MAP_PRIVATE, fd, 0);
+			if(Mapping == MAP_FAILED){
+				::close(fd);
+				throw std::invalid_argument("Cannot map response file " + Path);
+			}
+			::madvise(Mapping, Size, MADV_SEQUENTIAL);
+			Data = static_cast<const char*>(Mapping);
+			Mapped = true;
+		}
+		::close(fd);
+#else
+		std::ifstream File(Path, std::ios::binary | std::ios::ate);
+		if(!File)
+			throw std::invalid_argument("Cannot open response file " + Path);
+		Size = static_cast<std::size_t>(File.tellg());
+		Buffer.reset(new char[Size ? Size : 1]);
+		File.seekg(0);
+		if(!File.read(Buffer.get(), static_cast<std::streamsize>(Size)))
+			throw std::invalid_argument("Cannot read response file " + Path);
+		Data = Buffer.get();
+#endif
+	}
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+	~MappedFile(){
+#ifdef ARGPAR_POSIX
+		if(Mapped)
+			::munmap(const_cast<char*>(Data), Size);
+#endif
+	}
+
+	const char* data() const {return Data;}
+	std::size_t size() const {return Size;}
+
+	// Releases the memory of the pages before Position, they are read from the file again if accessed
+	void Release(const char* Position) const {
+#ifdef ARGPAR_POSIX
+		const std::size_t PageSize = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+		const std::size_t Length = static_cast<std::size_t>(Position - Data) / PageSize * PageSize;
+		if(Mapped && Length)
+			::madvise(const_cast<char*>(Data), Length, MADV_DONTNEED);
+#else
+		(void)Position;
+#endif
+	}
+};
+
+// Reads tokens from an array of strings or string views
+template<typename T>
+class ArrayTokenSource {
+	const T* p;
+	const T* const end;
+public:
+	ArrayTokenSource(const T* begin, const T* end) : p(begin), end(end) {}
+
+	// Reads the next token, returns false at the end
+	bool Next(std::string_view& Token){
+		if(p == end)
+			return false;
+		Token = *p++;
+		return true;
+	}
+	// Makes a token outlive the source, array elements already do
+	std::string_view Retain(std::string_view Token){return Token;}
+	// Adds the last read token to a range
+	void Record(TokenRange& Range){Range.Add(p - 1);}
+};
+
+/**
+ * @brief Reads tokens from another token source, replacing tokens of the form @file by the tokens in the file
+ * Files are split into tokens like Tokenize and may contain @file tokens themselves. Tokens view the memory mapped file,
+ * only tokens containing quotes or escapes that are retained are copied. Memory use does not grow with the size of the files, 
+ * read pages are released while reading and only the retained tokens and the files they view are kept, in a TokenStorage.
+ */
+template<typename Source>
+class ResponseFileTokenSource {
+	Source& Tokens;
+	TokenStorage& Storage;
+
+	struct Frame {
+		std::shared_ptr<const MappedFile> File;
+		const char* p;
+		const char* end;
+		const char* released; // pages before this position are released
+		const char* last = nullptr; // where reading the last token started
+		bool retained = false; // a retained or recorded token views the file
+	};
+	std::vector<Frame> Files;
+	TransientUnescape Unescaped;
+
+	static constexpr std::size_t MaxDepth = 64;
+	static constexpr std::size_t ReleaseInterval = std::size_t(1) << 24; // release read pages every 16 MiB
+
+	void Open(std::string_view Path){
+		if(Files.size() == MaxDepth)
+			throw std::invalid_argument("Response files nested more than " + std::to_string(MaxDepth) + " levels deep at @" + std::string(Path));
+		auto File = std::make_shared<const MappedFile>(std::string(Path));
+		const char* begin = File->data();
+		const char* end = begin + File->size();
+		Files.push_back(Frame{std::move(File), begin, end, begin});
+	}
+
+	// Closes a fully read file, files viewed by retained tokens are kept in the storage
+	void Close(){
+		if(Files.back().retained)
+			Storage.Files.push_back(std::move(Files.back().File));
+		Files.pop_back();
+	}
+
+public:
+	ResponseFileTokenSource(Source& Tokens, TokenStorage& Storage) : Tokens(Tokens), Storage(Storage) {}
+	ResponseFileTokenSource(const ResponseFileTokenSource&) = delete;
+	// Keeps the files that are still open when parsing stops early
+	~ResponseFileTokenSource(){
+		while(!Files.empty())
+			Close();
+	}
+
+	// Reads the next token, returns false at the end
+	bool Next(std::string_view& Token){
+		while(true){
+			if(Files.empty()){
+				if(!Tokens.Next(Token))
+					return false;
+			}
+			else{
+				Frame& Top = Files.back();
+				Top.last = Top.p;
+				if(!ReadToken<DefaultScan>(Top.p, Top.end, Unescaped, Token)){
+					Close();
+					continue;
+				}
+				if(static_cast<std::size_t>(Top.p - Top.released) >= ReleaseInterval){
+					Top.File->Release(Top.p);
+					Top.released = Top.p;
+				}
+			}
+			if(Token.size() > 1 && Token[0] == '@'){
+				Open(Token.substr(1));
+				continue;
+			}
+			return true;
+		}
+	}
+
+	// Makes the last read token outlive the source
+	std::string_view Retain(std::string_view Token){
+		if(Files.empty())
+			return Tokens.Retain(Token);
+		Frame& Top = Files.back();
+		if(Token.data() >= Top.File->data() && Token.data() < Top.File->data() + Top.File->size()){
+			Top.retained = true;
+			return Token;
+		}
+		// unescaped, copy it out of the reused buffer
+		Storage.Tokens.emplace_back(new char[Token.size() ? Token.size() : 1]);
+		std::memcpy(Storage.Tokens.back().get(), Token.data(), Token.size());
+		return std::string_view(Storage.Tokens.back().get(), Token.size());
+	}
+
+	// Adds the last read token to a range, tokens of a file are recorded as the text they were read from
+	void Record(TokenRange& Range){
+		if(Files.empty())
+			return Tokens.Record(Range);
+		Frame& Top = Files.back();
+		Top.retained = true;
+		Range.Add(Top.File.get(), Top.last, Top.p);
+	}
+};
+
+//?==== Argument sets ====?//
+
+// Counts the set bits of a word
+inline unsigned PopCount(std::uint64_t Word){
+#if defined(__GNUC__) || defined(__clang__)
+	return static_cast<unsigned>(__builtin_popcountll(Word));
+#else
+	unsigned Count = 0;
+	for(; Word; Word &= Word - 1)
+		Count++;
+	return Count;
+#endif
+}
+
+/**
+ * @brief A set of arguments of an ArgumentParser stored as a bit per argument, indexed by the position the argument was added at
+ * Checks against other sets work on 64 arguments at once.
+ */
+class ArgumentBits {
+	std::vector<std::uint64_t> Words;
+
+public:
+	// Bits of a single word of a set, sparse sets are stored as their non zero words
+	using Word = std::pair<std::size_t, std::uint64_t>;
+
+	explicit ArgumentBits(std::size_t Size = 0) : Words((Size + 63) / 64) {}
+
+	void Resize(std::size_t Size){Words.resize((Size + 63) / 64);}
+	void Set(std::size_t idx){Words[idx >> 6] |= std::uint64_t(1) << (idx & 63);}
+	void Reset(std::size_t idx){Words[idx >> 6] &= ~(std::uint64_t(1) << (idx & 63));}
+	bool Test(std::size_t idx) const {return (Words[idx >> 6] >> (idx & 63)) & 1;}
+	void Clear(){std::fill(Words.begin(), Words.end(), 0);}
+
+	// Checks if every argument of Other is in the set
+	bool Covers(const ArgumentBits& Other) const {
+		std::uint64_t Missing = 0;
+		for(std::size_t w = 0; w < Other.Words.size(); w++)
+			Missing |= Other.Words[w] & ~(w < Words.size() ? Words[w] : 0);
+		return !Missing;
+	}
+
+	// Counts the arguments of a sparse set that are in the set
+	std::size_t Count(const std::vector<Word>& Sparse) const {
+		std::size_t Count = 0;
+		for(const Word& Bits : Sparse)
+			Count += PopCount(Words[Bits.first] & Bits.second);
+		return Count;
+	}
+
+	// Gets the non zero words of the set
+	std::vector<Word> Sparse() const {
+		std::vector<Word> Sparse;
+		for(std::size_t w = 0; w < Words.size(); w++)
+			if(Words[w])
+				Sparse.emplace_back(w, Words[w]);
+		return Sparse;
+	}
+};
+
+//?==== Suggestions ====?//
+
+/**
+ * @brief Computes edit distances to a fixed pattern, the least insertions, deletions, substitutions and swaps of adjacent characters turning a text into the pattern
+ * Uses the bit-parallel algorithm of Myers with the extension of Hyyrö for swaps, which handles a character of the text for every character of the pattern at once.
+ * Every character is changed at most once, so a swapped pair is not edited further (optimal string alignment distance).
+ */
+class EditDistanceMatcher {
+	std::array<std::uint64_t, 256> Positions{}; // bit i is set in the entry of the i-th character of the pattern
+	std::size_t Length;
+
+public:
+	static constexpr std::size_t MaxLength = 64;
+
+	// The pattern should have at most MaxLength characters, further characters are ignored
+	explicit EditDistanceMatcher(std::string_view Pattern) : Length(std::min(Pattern.size(), MaxLength)) {
+		for(std::size_t i = 0; i < Length; i++)
+			Positions[static_cast<unsigned char>(Pattern[i])] |= std::uint64_t(1) << i;
+	}
+
+	/**
+	 * @brief Computes the edit distance between the pattern and Text
+	 * @param Limit Stops once the distance can no longer get within Limit
+	 * @return std::size_t The distance, or a value above Limit if it is above Limit
+	 */
+	std::size_t Distance(std::string_view Text, std::size_t Limit) const {
+		if(!Length)
+			return Text.size();
+		if((Text.size() > Length ? Text.size() - Length : Length - Text.size()) > Limit)
+			return Limit + 1;
+		const std::uint64_t Last = std::uint64_t(1) << (Length - 1);
+		// Vertical positive and negative differences of the current column, the diagonal zeros and matches of the previous one
+		std::uint64_t VP = ~std::uint64_t(0), VN = 0, D0 = 0, PreviousMatches = 0;
+		std::size_t Score = Length;
+		for(std::size_t j = 0; j < Text.size(); j++){
+			const std::uint64_t Matches = Positions[static_cast<unsigned char>(Text[j])];
+			const std::uint64_t Swaps = ((~D0 & Matches) << 1) & PreviousMatches;
+			D0 = (((Matches & VP) + VP) ^ VP) | Matches | VN | Swaps;
+			std::uint64_t HP = VN | ~(D0 | VP);
+			std::uint64_t HN = VP & D0;
+			if(HP & Last)
+				Score++;
+			else if(HN & Last)
+				Score--;
+			// every remaining character lowers the distance by at most one
+			if(Score > Limit + (Text.size() - j - 1))
+				return Limit + 1;
+			HP = (HP << 1) | 1;
+			HN <<= 1;
+			VP = HN | ~(D0 | HP);
+			VN = HP & D0;
+			PreviousMatches = Matches;
+		}
+		return Score;
+	}
+};
+
+// Hashes the character pairs of a string into a set of 64 buckets. An edit changes at most 3 pairs, so strings within edit distance k share all but 3k of the buckets of either
+inline std::uint64_t BigramSignature(std::string_view Text){
+	std::uint64_t Signature = 0;
+	for(std::size_t i = 1; i < Text.size(); i++)
+		Signature |= std::uint64_t(1) << ((static_cast<unsigned char>(Text[i - 1]) * 31u + static_cast<unsigned char>(Text[i])) & 63);
+	return Signature;
+}
+
+/**
+ * @brief Collects the callees closest to an unknown long callee, for "did you mean" suggestions
+ * Candidates are offered one by one. Those whose length or character pairs differ too much are skipped before computing their edit distance.
+ * Up to a third of the characters after the dashes may differ, at most 3.
+ */
+class SuggestionCollector {
+	std::size_t BodyLength; // characters after the dashes of the unknown callee
+	EditDistanceMatcher Matcher;
+	std::uint64_t Signature;
+	unsigned Bigrams;
+	std::size_t Limit;
+	// Distance, callee and the argument it belongs to
+	std::vector<std::tuple<std::size_t, std::string, std::uintptr_t>> Found;
+
+	static std::string_view Strip(std::string_view Callee){
+		return Callee.size() > 2 && Callee[0] == '-' && Callee[1] == '-' ? Callee.substr(2) : std::string_view();
+	}
+
+public:
+	explicit SuggestionCollector(std::string_view Unknown) 
+		: BodyLength(Strip(Unknown).size()), Matcher(Strip(Unknown)), Signature(BigramSignature(Strip(Unknown))), Bigrams(PopCount(Signature)),
+		  Limit(!BodyLength || BodyLength > EditDistanceMatcher::MaxLength ? 0 : std::min<std::size_t>(3, std::max<std::size_t>(1, BodyLength / 3))) {}
+
+	/**
+	 * @brief Offers a callee as suggestion
+	 * @param Callee A long callee
+	 * @param Owner Identifies the argument of the callee, only the closest callee of an argument is suggested
+	 * @param CalleeSignature The BigramSignature of the callee without its dashes
+	 */
+	void Offer(std::string_view Callee, std::uintptr_t Owner, std::uint64_t CalleeSignature){
+		const std::string_view Other = Strip(Callee);
+		if(!Limit || Other.empty() || (Other.size() > BodyLength ? Other.size() - BodyLength : BodyLength - Other.size()) > Limit)
+			return;
+		if(PopCount(Signature & CalleeSignature) + 3 * Limit < Bigrams)
+			return;
+		const std::size_t Distance = Matcher.Distance(Other, Limit);
+		if(Distance <= Limit)
+			Found.emplace_back(Distance, Callee, Owner);
+	}
+	void Offer(std::string_view Callee, std::uintptr_t Owner){Offer(Callee, Owner, BigramSignature(Strip(Callee)));}
+
+	// Gets the shortest and longest length without dashes a suggested callee can have, empty if nothing can be suggested
+	std::pair<std::size_t, std::size_t> Lengths() const {
+		if(!Limit)
+			return {1, 0};
+		return {BodyLength > Limit ? BodyLength - Limit : 1, BodyLength + Limit};
+	}
+
+	// Gets up to Count suggestions, closest first
+	std::vector<std::string> Take(std::size_t Count = 3){
+		std::sort(Found.begin(), Found.end());
+		std::vector<std::string> Suggestions;
+		std::vector<std::uintptr_t> Owners;
+		for(const auto& Candidate : Found){
+			if(Suggestions.size() == Count)
+				break;
+			if(std::find(Owners.begin(), Owners.end(), std::get<2>(Candidate)) != Owners.end())
+				continue;
+			Owners.push_back(std::get<2>(Candidate));
+			Suggestions.push_back(std::get<1>(Candidate));
+		}
+		return Suggestions;
+	}
+};
+
+//?==== Prefix matching ====?//
+
+/**
+ * @brief A compact prefix tree over callees, finds every callee starting with a prefix and the callees closest to an unknown one
+ * The callees are kept sorted and every node covers the range of callees sharing its prefix, so the matches of a prefix are a contiguous range.
+ * Nodes only exist where callees differ, a query walks one node per branching point. Children of a node are consecutive and sorted by character.
+ */
+class CalleeTrie {
+public:
+	using Entry = std::pair<std::string_view, Argument*>;
+
+private:
+	struct Node {
+		std::uint32_t Begin, End;	// callees below the node in Entries
+		std::uint32_t Depth;		// length of the prefix shared by the callees below the node
+		std::uint32_t FirstChild, ChildCount;
+		Argument* Unique;			// the argument of every callee below the node, nullptr if they differ
+	};
+	std::vector<Entry> Entries;
+	std::vector<Node> Nodes;
+	// Callees without their dashes grouped by length with their BigramSignature, for Similar
+	static constexpr std::size_t LengthBuckets = EditDistanceMatcher::MaxLength + 4; // longer callees share the last bucket
+	std::vector<std::pair<std::uint32_t, std::uint64_t>> ByLength;
+	std::vector<std::uint32_t> LengthStarts;
+
+	// Builds the node at Position over the callees in [Begin, End) and its children
+	void Build(std::uint32_t Position, std::uint32_t Begin, std::uint32_t End){
+		const std::string_view First = Entries[Begin].first, Last = Entries[End - 1].first;
+		std::uint32_t Depth = 0;
+		while(Depth < First.size() && Depth < Last.size() && First[Depth] == Last[Depth])
+			Depth++;
+		// a callee equal to the prefix sorts first and ends at this node, the others are split by their next character
+		const std::uint32_t Split = Begin + (First.size() == Depth);
+		auto GroupEnd = [&](std::uint32_t i){
+			const char c = Entries[i].first[Depth];
+			return static_cast<std::uint32_t>(std::partition_point(Entries.begin() + i, Entries.begin() + End, [&](const Entry& E){return E.first[Depth] == c;}) - Entries.begin());
+		};
+		std::uint32_t ChildCount = 0;
+		for(std::uint32_t i = Split; i < End; i = GroupEnd(i))
+			ChildCount++;
+		const std::uint32_t FirstChild = static_cast<std::uint32_t>(Nodes.size());
+		Nodes.resize(Nodes.size() + ChildCount);
+		Argument* Unique = Split != Begin ? Entries[Begin].second : nullptr;
+		bool Shared = true;
+		for(std::uint32_t i = Split, Child = FirstChild; i < End; Child++){
+			const std::uint32_t j = GroupEnd(i);
+			Build(Child, i, j);
+			if(Child == FirstChild && Split == Begin)
+				Unique = Nodes[Child].Unique;
+			Shared = Shared && Nodes[Child].Unique == Unique;
+			i = j;
+		}
+		Nodes[Position] = Node{Begin, End, Depth, FirstChild, ChildCount, Shared ? Unique : nullptr};
+	}
+
+	// Finds the node covering every callee starting with Prefix, nullptr if there are none
+	const Node* Find(std::string_view Prefix) const {
+		if(Nodes.empty())
+			return nullptr;
+		const Node* Current = &Nodes[0];
+		std::size_t Checked = 0;
+		for(;;){
+			const std::string_view Key = Entries[Current->Begin].first;
+			const std::size_t Compare = std::min<std::size_t>(Prefix.size(), Current->Depth);
+			if(Key.substr(Checked, Compare - Checked) != Prefix.substr(Checked, Compare - Checked))
+				return nullptr;
+			if(Prefix.size() <= Current->Depth)
+				return Current;
+			Checked = Current->Depth;
+			const char c = Prefix[Current->Depth];
+			const Node* Children = Nodes.data() + Current->FirstChild;
+			const Node* Child = std::lower_bound(Children, Children + Current->ChildCount, c, [&](const Node& N, char c){
+				return Entries[N.Begin].first[Current->Depth] < c;
+			});
+			if(Child == Children + Current->ChildCount || Entries[Child->Begin].first[Current->Depth] != c)
+				return nullptr;
+			Current = Child;
+		}
+	}
+
+public:
+	// Replaces the callees of the tree, the views should outlive the tree
+	void Assign(std::vector<Entry> Callees){
+		// Sort by the first 8 characters after the dashes packed into an integer, comparing the callees only if those are equal
+		std::vector<std::pair<std::uint64_t, const Entry*>> Keyed;
+		Keyed.reserve(Callees.size());
+		for(const Entry& Callee : Callees){
+			std::uint64_t Key = 0;
+			for(std::size_t i = 2; i < 10; i++)
+				Key = Key << 8 | (i < Callee.first.size() ? static_cast<unsigned char>(Callee.first[i]) : 0);
+			Keyed.emplace_back(Key, &Callee);
+		}
+		// Radix sort on the key a byte at a time, skipping bytes every key shares
+		std::vector<std::pair<std::uint64_t, const Entry*>> Buffer(Keyed.size());
+		for(unsigned Shift = 0; Shift < 64; Shift += 8){
+			std::array<std::size_t, 257> Offsets{};
+			for(const auto& Callee : Keyed)
+				Offsets[((Callee.first >> Shift) & 0xff) + 1]++;
+			if(std::find(Offsets.begin(), Offsets.end(), Keyed.size()) != Offsets.end())
+				continue;
+			for(std::size_t b = 1; b < Offsets.size(); b++)
+				Offsets[b] += Offsets[b - 1];
+			for(const auto& Callee : Keyed)
+				Buffer[Offsets[(Callee.first >> Shift) & 0xff]++] = Callee;
+			Keyed.swap(Buffer);
+		}
+		for(auto First = Keyed.begin(); First != Keyed.end();){
+			auto Last = std::find_if(First, Keyed.end(), [&](const auto& Callee){return Callee.first != First->first;});
+			std::sort(First, Last, [](const auto& A, const auto& B){return *A.second < *B.second;});
+			First = Last;
+		}
+		Entries.clear();
+		Entries.reserve(Keyed.size());
+		for(const auto& Callee : Keyed)
+			Entries.push_back(*Callee.second);
+		auto Bucket = [](const Entry& Callee){return std::min(Callee.first.size() - 2, LengthBuckets - 1);};
+		LengthStarts.assign(LengthBuckets + 1, 0);
+		for(const Entry& Callee : Entries)
+			LengthStarts[Bucket(Callee) + 1]++;
+		std::partial_sum(LengthStarts.begin(), LengthStarts.end(), LengthStarts.begin());
+		ByLength.resize(Entries.size());
+		std::vector<std::uint32_t> Next(LengthStarts.begin(), LengthStarts.end() - 1);
+		for(std::uint32_t i = 0; i < Entries.size(); i++)
+			ByLength[Next[Bucket(Entries[i])]++] = {i, BigramSignature(Entries[i].first.substr(2))};
+		Nodes.clear();
+		if(Entries.empty())
+			return;
+		Nodes.reserve(2 * Entries.size());
+		Nodes.resize(1);
+		Build(0, 0, static_cast<std::uint32_t>(Entries.size()));
+	}
+
+	std::size_t size() const {return Entries.size();}
+
+	// Gets the callees starting with Prefix in sorted order
+	std::pair<const Entry*, const Entry*> Matches(std::string_view Prefix) const {
+		const Node* Match = Find(Prefix);
+		if(!Match)
+			return {nullptr, nullptr};
+		return {Entries.data() + Match->Begin, Entries.data() + Match->End};
+	}
+
+	// Gets the argument of every callee starting with Prefix, nullptr if there are none or they belong to different arguments
+	Argument* UniqueMatch(std::string_view Prefix) const {
+		const Node* Match = Find(Prefix);
+		return Match ? Match->Unique : nullptr;
+	}
+
+	// Gets up to Count callees of different arguments closest to an unknown callee, see SuggestionCollector
+	std::vector<std::string> Similar(std::string_view Unknown, std::size_t Count = 3) const {
+		SuggestionCollector Collector(Unknown);
+		const auto Lengths = Collector.Lengths();
+		if(Entries.empty() || Lengths.first > Lengths.second)
+			return {};
+		const auto End = ByLength.begin() + LengthStarts[std::min(Lengths.second, LengthBuckets - 1) + 1];
+		for(auto Callee = ByLength.begin() + LengthStarts[std::min(Lengths.first, LengthBuckets - 1)]; Callee != End; ++Callee)
+			Collector.Offer(Entries[Callee->first].first, reinterpret_cast<std::uintptr_t>(Entries[Callee->first].second), Callee->second);
+		return Collector.Take(Count);
+	}
+};
+
+//?==== Parse errors ====?//
+
+/**
+ * @brief Why parsing failed, returned by ArgumentParser::TryParse instead of an exception
+ * Only records what failed, the token and the parser or argument it failed on. The message, suggestions and missing arguments 
+ * are formatted when asked for. An error of a missing required argument or a violated constraint also holds the presence bits of 
+ * the parse, copying it allocates. The parser and the parsed tokens should outlive it.
+ */
+class ParseError {
+	friend class ArgumentParser;
+
+	ParseErrc _Code = ParseErrc::None;
+	const ArgumentParser* _Parser = nullptr; // the parser or subcommand parser that failed
+	const Argument* _Argument = nullptr;
+	std::string_view _Token;
+	std::size_t _TokenIndex = npos;
+	std::size_t _Position = 0;
+	ArgumentBits _Present; // the passed arguments, only kept for required arguments and constraints
+
+	ParseError(ParseErrc Code, const ArgumentParser& Parser, const Argument* Arg, std::string_view Token, std::size_t TokenIndex, std::size_t Position = 0) 
+		: _Code(Code), _Parser(&Parser), _Argument(Arg), _Token(Token), _TokenIndex(TokenIndex), _Position(Position) {}
+	ParseError(ParseErrc Code, const ArgumentParser& Parser, ArgumentBits Present) 
+		: _Code(Code), _Parser(&Parser), _Present(std::move(Present)) {}
+
+	// Checks if an unknown token is a compound argument, of which the character at Position is unknown
+	bool Compound() const {return _Token.size() > 2 && _Token[1] != '-';}
+
+public:
+	// The index of tokens that are not on the command line, as those of config files and the environment
+	static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+	ParseError() = default;
+
+	// Returns true if parsing failed
+	explicit operator bool() const {return _Code != ParseErrc::None;}
+	ParseErrc Code() const {return _Code;}
+
+	/**
+	 * @brief Gets the index of the token parsing failed on, the program name is token 0
+	 * Tokens read from response files count as if they were passed in place of the @file token.
+	 * @return std::size_t The index, npos for missing required arguments, violated constraints and values of config files and the environment
+	 */
+	std::size_t TokenIndex() const {return _TokenIndex;}
+
+	// Gets the unknown or ambiguous token as passed, empty for other errors
+	std::string_view Token() const {return _Token;}
+
+	// Gets the argument of a MissingParameters or ValidatorFailed error, nullptr for other errors
+	const Argument* FailedArgument() const {return _Argument;}
+
+	// Gets the position the validator failed at, or the position of the unknown character in a compound argument
+	std::size_t Position() const {return _Position;}
+
+	/**
+	 * @brief Gets the callee parsing failed on
+	 * @return std::string The unknown or ambiguous callee or subcommand, the first callee of the failed argument, empty otherwise
+	 */
+	std::string Callee() const;
+
+	/**
+	 * @brief Gets the callees of an error, see UnknownArgument and ConstraintViolation
+	 * @return std::vector<std::string> The suggestions for an unknown callee or subcommand, the candidates of an ambiguous one, 
+	 * the missing required arguments or the arguments causing a constraint violation
+	 */
+	std::vector<std::string> Callees() const;
+
+	// Formats the message of the exception ParseArguments throws for the error, empty if parsing succeeded
+	std::string Message() const;
+
+	// Throws the exception ParseArguments throws for the error, does nothing if parsing succeeded
+	void Throw() const;
+};
+
+/**
+ * @brief The values of a successful ArgumentParser::TryParse call or the error it failed with
+ * Read like an expected, check it before reading the values.
+ */
+class ParseOutcome {
+	friend class ArgumentParser;
+
+	ParseResult _Result;
+	ParseError _Error;
+
+	ParseOutcome(ParseResult&& Result, ParseError&& Error) : _Result(std::move(Result)), _Error(std::move(Error)) {}
+
+public:
+	// Returns true if parsing succeeded
+	bool Ok() const {return !_Error;}
+	explicit operator bool() const {return Ok();}
+
+	/**
+	 * @brief Gets the values of all arguments
+	 * @throws the exception ParseArguments would have thrown if parsing failed, see ParseError::Throw
+	 */
+	const ParseResult& Value() const {
+		_Error.Throw();
+		return _Result;
+	}
+	const ParseResult& operator*() const {return _Result;}
+	const ParseResult* operator->() const {return &_Result;}
+
+	// Gets why parsing failed, Code() is None if it succeeded
+	const ParseError& Error() const {return _Error;}
+};
+
+//?==== Published settings ====?//
+
+/**
+ * @brief The values of all arguments of a parse converted to their types, published by ArgumentParser::Publish
+ * A snapshot is immutable once published, it is read through a PinnedSettings and ArgumentHandle.
+ */
+class SettingsSnapshot {
+	friend class ArgumentParser;
+	template<typename...> friend class ArgumentHandle;
+
+	struct Entry {
+		// The parsed or default values, nullptr if the argument has neither
+		std::shared_ptr<const TypedValuesBase> Values;
+		bool Passed = false;
+	};
+	// Indexed by the position the argument was added at
+	std::vector<Entry> Entries;
+	// Response files and unescaped tokens of the parse and the config and environment values, viewed by std::string_view values
+	TokenStorage Storage;
+	std::shared_ptr<const SourceTokens> Sources;
+	std::uint64_t _Version = 0;
+
+public:
+	// The amount of snapshots published by the parser up to this one
+	std::uint64_t Version() const noexcept {return _Version;}
+};
+
+/**
+ * @brief A snapshot pinned by a reader, it is not freed until the pin is destroyed, see ArgumentParser::Settings
+ * Pins are cheap and should be short lived, as publishing the next snapshot waits until the previous one is unpinned.
+ */
+class PinnedSettings {
+	friend class SettingsPublisher;
+
+	const SettingsSnapshot* Snapshot = nullptr;
+	std::atomic<std::size_t>* Readers = nullptr; // the reader count incremented for this pin
+
+	PinnedSettings(const SettingsSnapshot* Snapshot, std::atomic<std::size_t>* Readers) noexcept : Snapshot(Snapshot), Readers(Readers) {}
+
+	void Release() noexcept {
+		if(Readers)
+			Readers->fetch_sub(1, std::memory_order_release);
+		Readers = nullptr;
+	}
+
+public:
+	PinnedSettings(PinnedSettings&& Other) noexcept : Snapshot(Other.Snapshot), Readers(std::exchange(Other.Readers, nullptr)) {}
+	PinnedSettings& operator=(PinnedSettings&& Other) noexcept {
+		if(this != &Other){
+			Release();
+			Snapshot = Other.Snapshot;
+			Readers = std::exchange(Other.Readers, nullptr);
+		}
+		return *this;
+	}
+	~PinnedSettings(){Release();}
+
+	const SettingsSnapshot& operator*() const noexcept {return *Snapshot;}
+	const SettingsSnapshot* operator->() const noexcept {return Snapshot;}
+};
+
+/**
+ * @brief Publishes settings snapshots to concurrent readers, read-copy-update style
+ * Readers pin the current snapshot without locking, allocating or waiting for a writer. Publish swaps in the new snapshot 
+ * and frees the previous one after a grace period, once every reader that could have pinned it is done.
+ * Readers are counted per epoch in cache line sized stripes, a thread always uses the same stripe so readers on different cores rarely share a counter. 
+ * A writer swaps the snapshot, advances the epoch and waits for the readers of the previous epoch, later readers see the new snapshot.
+ */
+class SettingsPublisher {
+	static constexpr std::size_t Stripes = 16;
+	struct alignas(64) Stripe {
+		std::atomic<std::size_t> Readers{0};
+	};
+
+	std::atomic<const SettingsSnapshot*> Current{nullptr};
+	std::atomic<std::size_t> Epoch{0};
+	mutable Stripe Counters[2][Stripes];
+	std::mutex WriteMutex;
+
+	static std::size_t ThreadStripe() noexcept {
+		static std::atomic<std::size_t> NextThread{0};
+		thread_local const std::size_t Index = NextThread.fetch_add(1, std::memory_order_relaxed) % Stripes;
+		return Index;
+	}
+
+public:
+	SettingsPublisher() = default;
+	SettingsPublisher(const SettingsPublisher&) = delete;
+	SettingsPublisher& operator=(const SettingsPublisher&) = delete;
+	~SettingsPublisher(){delete Current.load();}
+
+	// Pins the current snapshot, which is nullptr if none was published
+	PinnedSettings Read() const noexcept {
+		const std::size_t Index = ThreadStripe();
+		for(;;){
+			const std::size_t Pinned = Epoch.load();
+			std::atomic<std::size_t>& Readers = Counters[Pinned & 1][Index].Readers;
+			Readers.fetch_add(1);
+			// a writer waiting for this epoch may have missed the increment if the epoch moved on, pin in the new epoch instead
+			if(Epoch.load() == Pinned)
+				return PinnedSettings(Current.load(), &Readers);
+			Readers.fetch_sub(1, std::memory_order_release);
+		}
+	}
+
+	// Publishes a snapshot, returns once no reader pins the previous one. A thread should not publish while pinning a snapshot itself
+	void Publish(std::unique_ptr<const SettingsSnapshot> Snapshot){
+		std::lock_guard<std::mutex> Lock(WriteMutex);
+		std::unique_ptr<const SettingsSnapshot> Previous(Current.exchange(Snapshot.release()));
+		// readers of the previous epochs were waited for by the previous publish, only readers of the current epoch can pin the previous snapshot
+		const std::size_t Pinned = Epoch.fetch_add(1);
+		for(Stripe& Counter : Counters[Pinned & 1])
+			while(Counter.Readers.load()) // sequentially consistent with the increment and epoch check of the readers
+				std::this_thread::yield();
+	}
+};
+
+/**
+ * @brief A typed handle of an argument, reading its values from the settings published by ArgumentParser::Publish
+ * A read indexes the pinned snapshot by the position of the argument and returns the converted value, without looking up the callee, 
+ * converting, allocating or locking. Reads are safe from any thread, also while another thread publishes new settings.
+ * @code
+ * ArgumentHandle<int> Port = AP.addArgument<int>("-p", "--port").DefaultValue(8080);
+ * AP.Publish(argc, argv);
+ * int port = Port.Get();
+ * @endcode
+ * @tparam ParamTypes The types the argument was added with, bool for flags
+ */
+template<typename ...ParamTypes>
+class ArgumentHandle {
+	static_assert(sizeof...(ParamTypes) > 0, "A handle needs the parameter types of its argument, flags are bool");
+	const ArgumentParser* Parser = nullptr;
+	std::size_t Index = 0;
+
+	template<std::size_t I>
+	using ParamType = typename std::tuple_element<I, std::tuple<ParamTypes...>>::type;
+
+	const TypedValues<ParamTypes...>& Values(const PinnedSettings& Settings) const;
+
+public:
+	ArgumentHandle() = default;
+
+	/**
+	 * @brief Construct a handle of an argument
+	 * @throws logic_error exception if the argument was added with other types
+	 */
+	ArgumentHandle(const Argument& Arg);
+
+	/**
+	 * @brief Gets a value of the argument from pinned settings
+	 * @tparam I The position of the parameter
+	 * @return const T& The parsed or default value, valid as long as the pin
+	 * @throws logic_error exception if the argument has no value in the settings
+	 */
+	template<std::size_t I = 0>
+	const ParamType<I>& Get(const PinnedSettings& Settings) const {return Values(Settings).template At<I>();}
+
+	/**
+	 * @brief Gets a copy of a value of the argument from the current settings
+	 * @throws logic_error exception if no settings were published or the argument has no value
+	 */
+	template<std::size_t I = 0>
+	ParamType<I> Get() const;
+
+	// Checks if the argument was passed, on the command line or by a config source
+	bool Passed(const PinnedSettings& Settings) const {return Settings->Entries[Index].Passed;}
+	bool Passed() const;
+};
+
+//?==== Help ====?//
+
+/**
+ * @brief Gets the width of the terminal to wrap help to
+ * Uses the size of the terminal stdout writes to, if stdout is not a terminal the COLUMNS environment variable, otherwise 80.
+ * @return std::size_t The width in characters
+ */
+inline std::size_t TerminalWidth(){
+#ifdef ARGPAR_POSIX
+	winsize Size;
+	if(ioctl(STDOUT_FILENO, TIOCGWINSZ, &Size) == 0 && Size.ws_col)
+		return Size.ws_col;
+#endif
+	if(const char* Columns = std::getenv("COLUMNS")){
+		std::size_t Width = 0;
+		const std::string_view Value(Columns);
+		const auto result = std::from_chars(Value.data(), Value.data() + Value.size(), Width);
+		if(result.ec == std::errc() && result.ptr == Value.data() + Value.size() && Width)
+			return Width;
+	}
+	return 80;
+}
+
+class ArgumentParser {
+	friend class Argument;
+	friend class ParseResult;
+	friend class ParseError;
+	template<typename> friend class IncrementalParser;
+	template<typename...> friend class ArgumentHandle;
+
+	// Flags, parameter counts, priorities and strings of the arguments
+	ArgumentTable Table;
+	// The arguments, elements of a deque do not move when more are added
+	std::deque<Argument> Arguments;
+	std::string ProgramName;
+	std::size_t Version[2];
+	// Arguments in the order they were added
+	std::vector<Argument*> ArgumentList;
+	// Tokens and unescaped tokens of the last ParseCommandLine call, viewed by the arguments
+	std::vector<std::string_view> CommandLineTokens;
+	std::unique_ptr<char[]> CommandLineStorage;
+	// Operands of the last ParseArguments call
+	TokenRange _Operands;
+	// Response files and their unescaped tokens of the last ParseArguments call, viewed by the arguments
+	TokenStorage ResponseFileStorage;
+	// Config and environment values of the last ParseArguments call, viewed by the arguments
+	std::shared_ptr<const SourceTokens> CommittedSources;
+	// Replace @file tokens by the tokens in the file
+	bool ExpandResponseFiles = false;
+
+	// Maps every long callee of every argument to the index of its argument. The keys view the callees interned in Table
+	std::unordered_map<std::string_view, std::uint32_t> CalleeIndex;
+	// Single character callees indexed by their character, used to disect compound arguments without building strings
+	std::array<Argument*, 256> ShortCalleeIndex{};
+	// Prefix tree over the long callees for abbreviations, completion and suggestions, built on first use after arguments were added
+	mutable CalleeTrie Trie;
+	// The amount of arguments Trie was built for, guarded by TrieMutex while building
+	mutable std::atomic<std::size_t> TrieArguments{0};
+	mutable std::mutex TrieMutex;
+	// Resolve unambiguous prefixes of long callees, see Abbreviations
+	bool AllowAbbreviations = false;
+	// Answer completion queries of the completion scripts, see ShellCompletion
+	bool CompletionMode = false;
+
+	// Help page and default usage rendered once, rendered again when an argument or the width changes
+	struct HelpCache {
+		bool UsageValid = false;
+		bool PageValid = false;
+		std::size_t Revision = 0;
+		std::size_t Width = 0;
+		std::string Usage;
+		std::string Page;
+	};
+	mutable HelpCache CachedHelp;
+	// Guards CachedHelp, the default usage is rendered by concurrent Parse calls
+	mutable std::mutex HelpMutex;
+	// The width help is wrapped to, 0 uses TerminalWidth()
+	std::size_t HelpColumns = 0;
+
+	// Range of parameter tokens following an argument
+	struct TokenSpan {
+		std::size_t first;
+		std::size_t count;
+		std::size_t token = ParseError::npos; // index of the argument token, see ParseError::TokenIndex
+	};
+
+	// Values of an argument from a configuration source, layered below the command line
+	struct SourceValues {
+		Argument* Arg;
+		TokenSpan Span; // parameters in Sources->Parameters
+	};
+	// Values from config files in load order and from the environment, later values override earlier ones
+	std::vector<SourceValues> ConfigValues;
+	std::vector<SourceValues> EnvironmentValues;
+	// Parameters of the source values. Replaced by ReloadSources, the parse results, committed values and published settings viewing them share ownership
+	std::shared_ptr<SourceTokens> Sources = std::make_shared<SourceTokens>();
+	// The loaded config files and environment prefix, read again by ReloadSources
+	std::vector<std::string> ConfigPaths;
+	std::optional<std::string> EnvironmentVariablePrefix;
+	// The settings published to ArgumentHandle readers, see Publish
+	SettingsPublisher Published;
+	std::uint64_t PublishCount = 0;
+
+	// Required arguments, kept up to date by Argument::Required
+	ArgumentBits RequiredArguments;
+	std::size_t RequiredCount = 0;
+
+	// A constraint between arguments, checked against the set of passed arguments
+	struct Constraint {
+		enum class Kind {MutuallyExclusive, AtLeastOneOf, Requires, ConflictsWith};
+		Kind kind;
+		std::size_t Subject; // the argument that requires or conflicts with the members
+		std::vector<ArgumentBits::Word> Members;
+		std::size_t MemberCount;
+
+		// Checks the constraint against the passed arguments
+		bool Violated(const ArgumentBits& Present) const {
+			switch(kind){
+			case Kind::MutuallyExclusive: return Present.Count(Members) > 1;
+			case Kind::AtLeastOneOf: return Present.Count(Members) == 0;
+			case Kind::Requires: return Present.Test(Subject) && Present.Count(Members) < MemberCount;
+			case Kind::ConflictsWith: return Present.Test(Subject) && Present.Count(Members) > 0;
+			}
+			return false;
+		}
+	};
+	std::vector<Constraint> Constraints;
+
+	// Threads running validators and actions, 0 and 1 run them on the parsing thread, see ConcurrentActions
+	std::size_t ActionThreads = 0;
+	// Amount of dependencies between arguments, see Argument::DependsOn
+	std::size_t DependencyCount = 0;
+
+	// A subcommand, its parser is built by the factory on first use
+	struct SubcommandEntry {
+		std::string Help;
+		std::function<void(ArgumentParser&)> Factory;
+		mutable std::once_flag Built;
+		mutable std::unique_ptr<ArgumentParser> Parser;
+
+		SubcommandEntry(std::string Help, std::function<void(ArgumentParser&)> Factory) : Help(std::move(Help)), Factory(std::move(Factory)) {}
+	};
+	// Subcommands by name, only those that are used get a parser
+	std::map<std::string, SubcommandEntry, std::less<>> Subcommands;
+	// The subcommand passed to the last ParseArguments call, empty if none
+	std::string_view SelectedSubcommand;
+
+	// checks if a token is an argument
+	static bool isArgument(std::string_view Callee){return IsArgumentToken(Callee);}
+
+	// checks if a token can be a parameter of an argument, flags only take a following 0, 1, true or false so operands can follow them
+	bool TakesParameter(std::size_t Index, std::string_view Token) const {
+		bool Value;
+		return !Table.Has(Index, ArgumentFlag::IsFlag) || FastConvert(Token, Value);
+	}
+
+	// The index of no argument, see FindIndex
+	static constexpr std::size_t NoArgument = std::numeric_limits<std::size_t>::max();
+
+	// Looks up the index of an argument by any of its callees without reading the argument, returns NoArgument if the callee is unknown
+	std::size_t FindIndex(std::string_view Callee) const {
+		if(Callee.size() == 2 && Callee[0] == '-'){
+			const Argument* Short = ShortCalleeIndex[static_cast<unsigned char>(Callee[1])];
+			return Short ? Short->_index : NoArgument;
+		}
+		auto it = CalleeIndex.find(Callee);
+		return it == CalleeIndex.end() ? NoArgument : it->second;
+	}
+
+	// Looks up an argument by any of its callees, returns nullptr if the callee is unknown
+	Argument* FindCallee(std::string_view Callee) const {
+		const std::size_t Index = FindIndex(Callee);
+		return Index == NoArgument ? nullptr : ArgumentList[Index];
+	}
+
+	// Gets the prefix tree over the long callees, rebuilt once after arguments were added. Safe to call from concurrent parses
+	const CalleeTrie& LongCallees() const {
+		if(TrieArguments.load(std::memory_order_acquire) != ArgumentList.size()){
+			std::lock_guard<std::mutex> Lock(TrieMutex);
+			if(TrieArguments.load(std::memory_order_relaxed) != ArgumentList.size()){
+				std::vector<CalleeTrie::Entry> Entries;
+				Entries.reserve(CalleeIndex.size());
+				for(const auto& Entry : CalleeIndex)
+					Entries.emplace_back(Entry.first, ArgumentList[Entry.second]);
+				Trie.Assign(std::move(Entries));
+				TrieArguments.store(ArgumentList.size(), std::memory_order_release);
+			}
+		}
+		return Trie;
+	}
+
+	/**
+	 * @brief Looks up the argument of an abbreviated long callee, as --verb for --verbose
+	 * @param Ambiguous Set if the callees starting with the abbreviation belong to different arguments
+	 * @return Argument* The argument, nullptr if no callee or callees of different arguments start with the abbreviation
+	 */
+	Argument* FindAbbreviation(std::string_view Callee, bool& Ambiguous) const {
+		if(Callee.size() < 3 || Callee[1] != '-')
+			return nullptr;
+		const CalleeTrie& Callees = LongCallees();
+		if(Argument* Match = Callees.UniqueMatch(Callee))
+			return Match;
+		const auto Matches = Callees.Matches(Callee);
+		Ambiguous = Matches.first != Matches.second;
+		return nullptr;
+	}
+
+	// Gets the callees an ambiguous abbreviation could be, see FindAbbreviation
+	std::vector<std::string> AbbreviationCandidates(std::string_view Callee) const {
+		const auto Matches = LongCallees().Matches(Callee);
+		std::vector<std::string> Candidates;
+		for(auto it = Matches.first; it != Matches.second; ++it)
+			Candidates.emplace_back(it->first);
+		return Candidates;
+	}
+
+	static std::string AmbiguousMessage(std::string_view Callee, const std::vector<std::string>& Candidates){
+		return "Ambiguous console argument: " + std::string(Callee) + " could be " + JoinCallees(Candidates) + " use -h for help";
+	}
+
+	// Throws for an ambiguous abbreviation, see FindAbbreviation
+	[[noreturn]] void ThrowAmbiguous(std::string_view Callee) const {
+		throw std::invalid_argument(AmbiguousMessage(Callee, AbbreviationCandidates(Callee)));
+	}
+
+	// Formats the message of an unknown argument or subcommand, What names which of both
+	static std::string UnknownMessage(const char* What, std::string_view Token, const std::vector<std::string>& Suggestions){
+		std::string Message = What + std::string(Token);
+		if(!Suggestions.empty())
+			Message += ", did you mean " + JoinCallees(Suggestions) + "?";
+		return Message + " use -h for help";
+	}
+
+	/**
+	 * @brief Throws for an unknown argument with the closest callees as suggestions
+	 * @param Token The unknown argument as passed
+	 * @param Query The callee to find suggestions for, a single dash compound is looked up as long callee in case a dash was forgotten
+	 */
+	[[noreturn]] void ThrowUnknown(std::string_view Token, std::string_view Query) const {
+		std::vector<std::string> Suggestions = LongCallees().Similar(Query);
+		const std::string Message = UnknownMessage("Unkown console argument: ", Token, Suggestions);
+		throw UnknownArgument(Message, std::string(Token), std::move(Suggestions));
+	}
+
+	// Gets the subcommands closest to an unknown one
+	std::vector<std::string> SubcommandSuggestions(std::string_view Operand) const {
+		SuggestionCollector Collector("--" + std::string(Operand));
+		std::uintptr_t Owner = 0;
+		for(const auto& Command : Subcommands)
+			Collector.Offer("--" + Command.first, Owner++);
+		std::vector<std::string> Suggestions = Collector.Take();
+		for(std::string& Suggestion : Suggestions)
+			Suggestion.erase(0, 2);
+		return Suggestions;
+	}
+
+	// Throws for an unknown subcommand with the closest subcommands as suggestions
+	[[noreturn]] void ThrowUnknownSubcommand(std::string_view Operand) const {
+		std::vector<std::string> Suggestions = SubcommandSuggestions(Operand);
+		const std::string Message = UnknownMessage("Unknown subcommand: ", Operand, Suggestions);
+		throw UnknownArgument(Message, std::string(Operand), std::move(Suggestions));
+	}
+
+	// Looks up an argument by a callee or, if enabled, an abbreviation of a long callee, see FindAbbreviation
+	Argument* LookupCallee(std::string_view Callee, bool& Ambiguous) const {
+		const std::size_t Index = LookupIndex(Callee, Ambiguous);
+		return Index == NoArgument ? nullptr : ArgumentList[Index];
+	}
+	std::size_t LookupIndex(std::string_view Callee, bool& Ambiguous) const {
+		const std::size_t Index = FindIndex(Callee);
+		if(Index != NoArgument || !AllowAbbreviations)
+			return Index;
+		const Argument* Found = FindAbbreviation(Callee, Ambiguous);
+		return Found ? Found->_index : NoArgument;
+	}
+
+	// Writes the completions of the words following the completion command and exits, see HandleCompletion
+	[[noreturn]] void CompleteAndExit(const std::vector<std::string_view>& Words) const {
+		const std::vector<std::string> Completions = Complete(Words);
+		std::string Out;
+		for(const std::string& Completion : Completions){
+			Out += Completion;
+			Out += '\n';
+		}
+		std::cout << Out << std::flush;
+		exit(0);
+	}
+
+	// Splits a string by a delimiter
+	std::vector<std::string> SplitByDelimiter(std::string source, std::string delimiter){
+		std::vector<std::string> split;
+		size_t pos = 0;
+		while ((pos = source.find(delimiter)) != std::string::npos) {
+			split.push_back(source.substr(0, pos));
+			source.erase(0, pos + delimiter.length());
+		}
+		split.push_back(source);
+
+		return split;
+	}
+
+	// Removes leading and trailing whitespace
+	static std::string_view TrimWhitespace(std::string_view Text){
+		while(!Text.empty() && IsShellWhitespace(Text.front()))
+			Text.remove_prefix(1);
+		while(!Text.empty() && IsShellWhitespace(Text.back()))
+			Text.remove_suffix(1);
+		return Text;
+	}
+
+	// Copies a token into the storage
+	static std::string_view StoreToken(TokenStorage& Storage, std::string_view Token){
+		Storage.Tokens.emplace_back(new char[Token.size() ? Token.size() : 1]);
+		std::memcpy(Storage.Tokens.back().get(), Token.data(), Token.size());
+		return std::string_view(Storage.Tokens.back().get(), Token.size());
+	}
+
+	// Copies the parameters of the values of the layers into new sources and updates their spans. Tokens viewing a retained config file stay views, 
+	// the other tokens are copied, so the new sources only hold the values of the layers. Parse results viewing the current sources keep them
+	std::shared_ptr<SourceTokens> CopySources(std::initializer_list<std::vector<SourceValues>*> Layers) const {
+		auto Copy = std::make_shared<SourceTokens>();
+		Copy->Storage.Files = Sources->Storage.Files;
+		auto ViewsFile = [&](std::string_view Token){
+			return std::any_of(Copy->Storage.Files.begin(), Copy->Storage.Files.end(), [&](const auto& File){
+				return Token.data() >= File->data() && Token.data() < File->data() + File->size();});
+		};
+		for(std::vector<SourceValues>* Layer : Layers)
+			for(SourceValues& Values : *Layer){
+				const std::size_t first = Copy->Parameters.size();
+				for(std::size_t k = 0; k < Values.Span.count; k++){
+					const std::string_view Token = Sources->Parameters[Values.Span.first + k];
+					Copy->Parameters.push_back(ViewsFile(Token) ? Token : StoreToken(Copy->Storage, Token));
+				}
+				Values.Span.first = first;
+			}
+		return Copy;
+	}
+
+	// Maps every callee without its leading dashes to its argument, the names of config file settings
+	std::unordered_map<std::string_view, Argument*> BuildSettingIndex() const {
+		std::unordered_map<std::string_view, Argument*> SettingIndex;
+		for(Argument* _Arg : ArgumentList)
+			for(std::size_t c = 0; c < _Arg->CalleeCount(); c++)
+				SettingIndex.emplace(_Arg->Callees[c].substr(_Arg->Callees[c].find_first_not_of('-')), _Arg);
+		return SettingIndex;
+	}
+
+	// Gets the arguments sorted by their first callee, the order of the help
+	std::vector<const Argument*> SortedArguments() const {
+		std::vector<const Argument*> Sorted(ArgumentList.begin(), ArgumentList.end());
+		std::sort(Sorted.begin(), Sorted.end(), [](const Argument* A, const Argument* B){return A->Callees[0] < B->Callees[0];});
+		return Sorted;
+	}
+
+	// Changes whenever an argument is added or a detail shown in the help changes, revisions only increase
+	std::size_t HelpRevision() const {
+		std::size_t Revision = ArgumentList.size() + Subcommands.size();
+		for(const Argument* _Arg : ArgumentList)
+			Revision += _Arg->_revision;
+		return Revision;
+	}
+
+	// Renders the help of the arguments, the help strings start at a shared column that fits the longest callees
+	static void RenderHelpPage(std::string& Out, const std::vector<const Argument*>& Args, std::size_t Width){
+		std::size_t Longest = 0;
+		for(const Argument* _Arg : Args)
+			Longest = std::max(Longest, _Arg->GetCalleeFormatted().size());
+		// callees longer than a third of the width get a line of their own
+		const std::size_t Column = std::min(Longest + 2, std::max<std::size_t>(Width / 3, 8));
+		for(const Argument* _Arg : Args){
+			_Arg->RenderHelp(Out, Column, Width);
+			Out += '\n';
+		}
+	}
+
+	// Renders the names and help strings of the subcommands, their parsers are not built
+	void RenderSubcommands(std::string& Out, std::size_t Width) const {
+		if(Subcommands.empty())
+			return;
+		std::size_t Longest = 0;
+		for(const auto& Command : Subcommands)
+			Longest = std::max(Longest, Command.first.size());
+		const std::size_t Column = std::min(Longest + 2, std::max<std::size_t>(Width / 3, 8));
+		Out += "Commands:\n";
+		for(const auto& Command : Subcommands){
+			Out += '\t';
+			Out += Command.first;
+			if(Command.first.size() >= Column){
+				Out += "\n\t";
+				Out.append(Column, ' ');
+			}
+			else
+				Out.append(Column - Command.first.size(), ' ');
+			Argument::AppendWrapped(Out, Command.second.Help, Column, Width);
+			Out += '\n';
+		}
+	}
+
+	// Gets the parser of a subcommand, built by its factory on first use. Safe to call from concurrent parses
+	ArgumentParser& BuildSubcommand(const std::string& Name, const SubcommandEntry& Entry) const {
+		std::call_once(Entry.Built, [&]{
+			auto Sub = std::make_unique<ArgumentParser>(ProgramName + " " + Name, Version[0], Version[1]);
+			Entry.Factory(*Sub);
+			Entry.Parser = std::move(Sub);
+		});
+		return *Entry.Parser;
+	}
+
+	// Renders the parts of the help cache that are out of date, HelpMutex should be held
+	void UpdateHelpCache(bool NeedsPage) const {
+		const std::size_t Revision = HelpRevision();
+		if(Revision != CachedHelp.Revision){
+			CachedHelp.UsageValid = CachedHelp.PageValid = false;
+			CachedHelp.Revision = Revision;
+		}
+		if(!CachedHelp.UsageValid){
+			std::string& Usage = CachedHelp.Usage;
+			Usage = "./" + ProgramName + " ";
+			for(const Argument* _Arg : SortedArguments()){
+				if(_Arg->Has(ArgumentFlag::Required)){
+					Usage += _Arg->Callees[0];
+					Usage += ' ';
+					_Arg->FormatParameters(Usage);
+					Usage += ' ';
+				}
+			}
+			if(!Subcommands.empty())
+				Usage += "<command> ";
+			CachedHelp.UsageValid = true;
+		}
+		if(NeedsPage){
+			const std::size_t Width = HelpColumns ? HelpColumns : TerminalWidth();
+			if(!CachedHelp.PageValid || CachedHelp.Width != Width){
+				const std::vector<const Argument*> Args = SortedArguments();
+				std::string& Page = CachedHelp.Page;
+				Page = "Default Usage: " + CachedHelp.Usage + "\n";
+				RenderHelpPage(Page, Args, Width);
+				RenderSubcommands(Page, Width);
+				CachedHelp.Width = Width;
+				CachedHelp.PageValid = true;
+			}
+		}
+	}
+
+	// Checks if the passed arguments include all required arguments and satisfy all constraints
+	bool Satisfied(const ArgumentBits& Present) const {
+		if(!Present.Covers(RequiredArguments))
+			return false;
+		for(const Constraint& C : Constraints)
+			if(C.Violated(Present))
+				return false;
+		return true;
+	}
+
+	// Gets the callees of the arguments of a sparse set that are passed or not
+	std::vector<std::string> ConstraintArguments(const std::vector<ArgumentBits::Word>& Members, const ArgumentBits& Present, bool Passed) const {
+		std::vector<std::string> Callees;
+		for(const ArgumentBits::Word& Bits : Members)
+			for(std::size_t b = 0; b < 64; b++)
+				if(((Bits.second >> b) & 1) && Present.Test(Bits.first * 64 + b) == Passed)
+					Callees.emplace_back(ArgumentList[Bits.first * 64 + b]->Callees[0]);
+		return Callees;
+	}
+
+	static std::string JoinCallees(const std::vector<std::string>& Callees){
+		std::string Joined;
+		for(const std::string& Callee : Callees)
+			Joined += (Joined.empty() ? "" : ", ") + Callee;
+		return Joined;
+	}
+
+	// A required argument or constraint the passed arguments violate, see Violation
+	struct ViolationReport {
+		ParseErrc Code = ParseErrc::None; // MissingRequired or ConstraintViolated, None if nothing is violated
+		std::string Message;
+		std::string Constraint; // see ConstraintViolation::Constraint
+		std::vector<std::string> Arguments; // the missing required arguments or those causing the violation
+	};
+
+	// Describes the first required argument or constraint the passed arguments violate, see Satisfied
+	ViolationReport Violation(const ArgumentBits& Present) const {
+		ViolationReport Report;
+		if(!Present.Covers(RequiredArguments)){
+			Report.Code = ParseErrc::MissingRequired;
+			for(const Argument* _Arg : SortedArguments())
+				if(_Arg->Has(ArgumentFlag::Required) && !Present.Test(_Arg->_index))
+					Report.Arguments.emplace_back(_Arg->Callees[0]);
+			Report.Message = "Not all required arguments were passed. Default usage: " + defaultUsage();
+			return Report;
+		}
+		for(const Constraint& C : Constraints){
+			if(!C.Violated(Present))
+				continue;
+			const std::vector<std::string> Passed = ConstraintArguments(C.Members, Present, true);
+			const std::vector<std::string> Missing = ConstraintArguments(C.Members, Present, false);
+			std::vector<std::string> Members = Passed;
+			Members.insert(Members.end(), Missing.begin(), Missing.end());
+			const std::string Subject(ArgumentList[C.Subject]->Callees[0]);
+			Report.Code = ParseErrc::ConstraintViolated;
+			switch(C.kind){
+			case Constraint::Kind::MutuallyExclusive:
+				Report = {Report.Code, "Arguments " + JoinCallees(Passed) + " can not be passed together", "mutually exclusive: " + JoinCallees(Members), Passed};
+				break;
+			case Constraint::Kind::AtLeastOneOf:
+				Report = {Report.Code, "At least one of " + JoinCallees(Missing) + " should be passed", "at least one of: " + JoinCallees(Missing), Missing};
+				break;
+			case Constraint::Kind::Requires:
+				Report = {Report.Code, "Argument " + Subject + " requires " + JoinCallees(Missing) + " to be passed as well", Subject + " requires: " + JoinCallees(Members), Missing};
+				break;
+			case Constraint::Kind::ConflictsWith:
+				Report = {Report.Code, "Argument " + Subject + " can not be passed together with " + JoinCallees(Passed), Subject + " conflicts with: " + JoinCallees(Members), Passed};
+				break;
+			}
+			return Report;
+		}
+		return Report;
+	}
+
+	/**
+	 * @brief Throws for the first required argument or constraint the passed arguments violate, see Violation
+	 * @throws MissingRequiredParameter if any required arguments are missing
+	 * @throws ConstraintViolation naming the violated constraint otherwise
+	 */
+	void ThrowViolation(const ArgumentBits& Present) const {
+		ViolationReport Report = Violation(Present);
+		if(Report.Code == ParseErrc::MissingRequired)
+			throw MissingRequiredParameter(Report.Message, Report.Arguments);
+		if(Report.Code == ParseErrc::ConstraintViolated)
+			throw ConstraintViolation(Report.Message, Report.Constraint, Report.Arguments);
+	}
+
+	// Adds a constraint between a subject and a set of arguments
+	ArgumentParser& AddConstraint(Constraint::Kind kind, std::string_view Subject, const std::vector<std::string_view>& Callees){
+		if(Callees.empty())
+			throw std::invalid_argument("A constraint needs at least 1 argument");
+		ArgumentBits Members(ArgumentList.size());
+		for(std::string_view Callee : Callees){
+			const Argument* _Arg = FindCallee(Callee);
+			if(!_Arg)
+				throw std::invalid_argument(std::string(Callee) + " argument does not exist");
+			Members.Set(_Arg->_index);
+		}
+		std::size_t SubjectIndex = 0;
+		if(!Subject.empty()){
+			const Argument* _Arg = FindCallee(Subject);
+			if(!_Arg)
+				throw std::invalid_argument(std::string(Subject) + " argument does not exist");
+			SubjectIndex = _Arg->_index;
+		}
+		std::vector<ArgumentBits::Word> Sparse = Members.Sparse();
+		std::size_t MemberCount = 0;
+		for(const ArgumentBits::Word& Bits : Sparse)
+			MemberCount += PopCount(Bits.second);
+		Constraints.push_back(Constraint{kind, SubjectIndex, std::move(Sparse), MemberCount});
+		return *this;
+	}
+
+	// generates default usage string based on required arguments and programname
+	std::string defaultUsage() const {
+		std::lock_guard<std::mutex> Lock(HelpMutex);
+		UpdateHelpCache(false);
+		return CachedHelp.Usage;
+	}
+
+public:
+	/**
+	 * @brief Sets the width the help is wrapped to
+	 * 
+	 * @param Width The width in characters, 0 uses the width of the terminal, see TerminalWidth()
+	 * @return ArgumentParser& The argument parser reference
+	 */
+	ArgumentParser& HelpWidth(std::size_t Width){
+		HelpColumns = Width;
+		return *this;
+	}
+
+	/**
+	 * @brief Enables response files
+	 * When enabled, a token of the form @file is replaced by the tokens in the file, which are split like Tokenize and may contain @file tokens themselves.
+	 * Files are memory mapped, parameter values view the mapping which is kept alive with the values.
+	 * Use it for argument lists beyond the command line length limit of the system.
+	 * @param Enable Whether to expand @file tokens
+	 * @return ArgumentParser& The argument parser reference
+	 */
+	ArgumentParser& ResponseFiles(bool Enable = true){
+		ExpandResponseFiles = Enable;
+		return *this;
+	}
+
+	/**
+	 * @brief Runs the validators and actions of the passed arguments on multiple threads
+	 * Arguments of the same priority run concurrently, a priority starts once every argument of a higher priority completed.
+	 * Order arguments within a priority with Argument::DependsOn. Parsing fails like it would serially, with the error of the first failing argument in parse order.
+	 * Instrumentation hooks are called from the worker threads, the validator, conversion and action timings add up the time of every thread.
+	 * Applies to ParseArguments, ParseCommandLine and Parse, an IncrementalParser runs them in order as they are passed.
+	 * @note Validators and actions should be safe to call concurrently, actions that exit like those of -h and -V end the whole process.
+	 * @param Threads The amount of threads including the parsing thread, 0 and 1 run them serially on the parsing thread
+	 * @return ArgumentParser& The argument parser reference
+	 */
+	ArgumentParser& ConcurrentActions(std::size_t Threads = std::thread::hardware_concurrency()){
+		ActionThreads = Threads;
+		return *this;
+	}
+
+	/**
+	 * @brief Adds a subcommand, as commit in ./program -v commit -m message
+	 * The first operand selects the subcommand, the tokens after it are parsed by the parser of the subcommand.
+	 * Its arguments are added by the factory when the subcommand is first passed or requested through Subcommand, 
+	 * so adding subcommands costs neither time nor memory for their arguments. The parser of a subcommand has its own help, required arguments and priorities.
+	 * @param Name The name of the subcommand
+	 * @param Factory Adds the arguments of the subcommand to the parser it is given
+	 * @param Help The help string listed in the help of this parser
+	 * @return ArgumentParser& The argument parser reference
+	 * @throws invalid_argument exception if the name is empty, starts with - or is already used
+	 */
+	ArgumentParser& AddSubcommand(std::string Name, std::function<void(ArgumentParser&)> Factory, std::string Help = ""){
+		if(Name.empty() || Name[0] == '-')
+			throw std::invalid_argument("Subcommand name " + Name + " should not be empty or start with -");
+		if(!Subcommands.try_emplace(Name, std::move(Help), std::move(Factory)).second)
+			throw std::invalid_argument("Subcommand " + Name + " already exists");
+		return *this;
+	}
+
+	/**
+	 * @brief Gets the parser of a subcommand, which holds the values of its arguments after ParseArguments selected it
+	 * @param Name The name of the subcommand
+	 * @return ArgumentParser& The parser of the subcommand, built by its factory if it was not used before
+	 * @throws invalid_argument exception if the subcommand does not exist
+	 */
+	ArgumentParser& Subcommand(std::string_view Name){
+		auto it = Subcommands.find(Name);
+		if(it == Subcommands.end())
+			throw std::invalid_argument(std::string(Name) + " subcommand does not exist");
+		return BuildSubcommand(it->first, it->second);
+	}
+
+	/**
+	 * @brief Resolves unambiguous prefixes of long callees, as --verb for --verbose
+	 * A callee that is passed in full is always used, even if it is a prefix of other callees. A prefix of callees of different arguments throws an invalid_argument exception.
+	 * @param Enable Whether to resolve abbreviations
+	 * @return ArgumentParser& The argument parser reference
+	 */
+	ArgumentParser& Abbreviations(bool Enable = true){
+		AllowAbbreviations = Enable;
+		return *this;
+	}
+
+	/**
+	 * @brief Enables the hidden completion mode used by the scripts of CompletionScript
+	 * When the first argument after the program name is CompleteCommand, the completions of the last argument are written to stdout one per line and the program exits, see Complete.
+	 * The mode is only checked by ParseArguments(argc, argv) and HandleCompletion, the other parse functions never exit.
+	 * @param Enable Whether to answer completion queries
+	 * @return ArgumentParser& The argument parser reference
+	 */
+	ArgumentParser& ShellCompletion(bool Enable = true){
+		CompletionMode = Enable;
+		return *this;
+	}
+
+	// The first token that asks for completions, see ShellCompletion
+	static constexpr std::string_view CompleteCommand = "__complete";
+
+	/**
+	 * @brief Answers a completion query of the completion scripts if completion is enabled, see ShellCompletion
+	 * ParseArguments(argc, argv) calls this itself, call it before Parse, TryParse or Publish when the program does not use ParseArguments.
+	 * @param argc The given argument count
+	 * @param argv The list of argument values
+	 * Exits the program after writing the completions if argv asks for them, returns otherwise.
+	 */
+	void HandleCompletion(const int argc, const char** argv) const {
+		if(CompletionMode && argc > 1 && argv[1] == CompleteCommand)
+			CompleteAndExit(std::vector<std::string_view>(argv + 2, argv + argc));
+	}
+
+	/**
+	 * @brief Gets the completions of the last word of a command line
+	 * A word starting with - completes to the callees starting with it, other words complete to the subcommands starting with it.
+	 * Words after a subcommand are completed by the subcommand, the parameters of an argument get no completions so the shell can complete files.
+	 * @param Words The words after the program name up to and including the word to complete, which may be empty
+	 * @return std::vector<std::string> The completions, short callees first and every group sorted
+	 */
+	std::vector<std::string> Complete(const std::vector<std::string_view>& Words) const {
+		std::vector<std::string> Completions;
+		if(Words.empty())
+			return Completions;
+		// Skip the parameters of the arguments before the word to complete
+		std::size_t Pending = 0;
+		for(std::size_t i = 0; i + 1 < Words.size(); i++){
+			const std::string_view Word = Words[i];
+			if(isArgument(Word)){
+				const Argument* Arg = FindCallee(Word);
+				if(!Arg && Word.size() > 2 && Word[1] != '-')
+					Arg = ShortCalleeIndex[static_cast<unsigned char>(Word.back())]; // the last argument of a compound takes the parameters
+				if(!Arg && AllowAbbreviations && Word[1] == '-')
+					Arg = LongCallees().UniqueMatch(Word);
+				Pending = Arg && !Arg->Has(ArgumentFlag::IsFlag) && !Arg->Has(ArgumentFlag::Variadic) ? Arg->ParamCount() : 0;
+			}
+			else if(Pending)
+				Pending--;
+			else if(!Subcommands.empty()){
+				auto it = Subcommands.find(Word);
+				if(it == Subcommands.end())
+					return Completions;
+				return BuildSubcommand(it->first, it->second).Complete(std::vector<std::string_view>(Words.begin() + i + 1, Words.end()));
+			}
+		}
+		if(Pending)
+			return Completions;
+		const std::string_view Prefix = Words.back();
+		if(Prefix.empty() || Prefix[0] != '-'){
+			for(auto it = Subcommands.lower_bound(Prefix); it != Subcommands.end() && it->first.compare(0, Prefix.size(), Prefix) == 0; ++it)
+				Completions.push_back(it->first);
+			return Completions;
+		}
+		if(Prefix.size() <= 2 && (Prefix.size() == 1 || Prefix[1] != '-')){
+			for(std::size_t c = 0; c < ShortCalleeIndex.size(); c++)
+				if(ShortCalleeIndex[c] && (Prefix.size() == 1 || static_cast<unsigned char>(Prefix[1]) == c))
+					Completions.push_back(std::string{'-', static_cast<char>(c)});
+		}
+		const auto Matches = LongCallees().Matches(Prefix);
+		for(auto it = Matches.first; it != Matches.second; ++it)
+			Completions.emplace_back(it->first);
+		return Completions;
+	}
+
+	/**
+	 * @brief Generates a completion script that completes the arguments of the program through the hidden completion mode, see ShellCompletion
+	 * Source the bash script from .bashrc, place the zsh script in a directory of fpath as _program or source it after compinit.
+	 * @param Shell bash or zsh
+	 * @param CommandName The name the executable is run by, e.g. the file name of argv[0]. May contain letters, digits and . _ - + /
+	 * @return std::string The script
+	 * @throws invalid_argument exception if the shell is not supported or the command name is empty or contains other characters
+	 */
+	std::string CompletionScript(std::string_view Shell, std::string_view CommandName) const {
+		// the name is pasted into shell code, only allow characters that need no quoting
+		if(CommandName.empty() || !std::all_of(CommandName.begin(), CommandName.end(), [](char c){
+				return std::isalnum(static_cast<unsigned char>(c)) || c == '.' || c == '_' || c == '-' || c == '+' || c == '/';}))
+			throw std::invalid_argument("Command name " + std::string(CommandName) + " can not be completed, use letters, digits and . _ - + /");
+		const std::string Name(CommandName);
+		std::string Function = "_";
+		for(char c : Name)
+			Function += std::isalnum(static_cast<unsigned char>(c)) ? c : '_';
+		Function += "_complete";
+		const std::string Command(CompleteCommand);
+		if(Shell == "bash")
+			return Function + "() {\n"
+				"\tlocal IFS=$'\\n'\n"
+				"\tCOMPREPLY=($(\"${COMP_WORDS[0]}\" " + Command + " \"${COMP_WORDS[@]:1:COMP_CWORD}\" 2>/dev/null))\n"
+				"}\n"
+				"complete -o default -F " + Function + " " + Name + "\n";
+		if(Shell == "zsh")
+			return "#compdef " + Name + "\n" + 
+				Function + "() {\n"
+				"\tlocal -a completions\n"
+				"\tcompletions=(\"${(@f)$(\"${words[1]}\" " + Command + " \"${(@)words[2,CURRENT]}\" 2>/dev/null)}\")\n"
+				"\tif [[ -n ${completions[1]} ]]; then\n"
+				"\t\tcompadd -a completions\n"
+				"\telse\n"
+				"\t\t_files\n"
+				"\tfi\n"
+				"}\n"
+				"compdef " + Function + " " + Name + "\n";
+		throw std::invalid_argument("No completion script for shell " + std::string(Shell) + ", use bash or zsh");
+	}
+
+	/**
+	 * @brief Gets the name of the subcommand passed to the last ParseArguments call
+	 * @return std::string_view The name, empty if no subcommand was passed
+	 */
+	std::string_view PassedSubcommand() const {return SelectedSubcommand;}
+
+	/**
+	 * @brief Allows at most one of the arguments to be passed
+	 * Constraints are checked after the required arguments, arguments set by config files or the environment count as passed.
+	 * @param Callees A callee of every argument of the group
+	 * @return ArgumentParser& The parser reference
+	 * @throws invalid_argument exception if an argument does not exist
+	 */
+	ArgumentParser& MutuallyExclusive(const std::vector<std::string_view>& Callees){
+		return AddConstraint(Constraint::Kind::MutuallyExclusive, {}, Callees);
+	}
+
+	/**
+	 * @brief Requires at least one of the arguments to be passed, see MutuallyExclusive
+	 */
+	ArgumentParser& AtLeastOneOf(const std::vector<std::string_view>& Callees){
+		return AddConstraint(Constraint::Kind::AtLeastOneOf, {}, Callees);
+	}
+
+	/**
+	 * @brief Requires the arguments to be passed if an argument is passed, see MutuallyExclusive
+	 * @param Callee A callee of the argument that requires the others
+	 * @param Required A callee of every required argument
+	 */
+	ArgumentParser& Requires(std::string_view Callee, const std::vector<std::string_view>& Required){
+		return AddConstraint(Constraint::Kind::Requires, Callee, Required);
+	}
+
+	/**
+	 * @brief Forbids the arguments to be passed if an argument is passed, see MutuallyExclusive
+	 * @param Callee A callee of the argument that conflicts with the others
+	 * @param Conflicting A callee of every conflicting argument
+	 */
+	ArgumentParser& ConflictsWith(std::string_view Callee, const std::vector<std::string_view>& Conflicting){
+		return AddConstraint(Constraint::Kind::ConflictsWith, Callee, Conflicting);
+	}
+
+	/**
+	 * @brief Loads the values of arguments from a config file
+	 * Values from config files override default values and are overridden by environment variables and the command line, see EnvironmentPrefix.
+	 * Arguments set by a config file are used like passed arguments: they count as passed for required arguments and IsUsed, and their validators and actions run while parsing.
+	 * The file is memory mapped and read in a single pass, every line holds a setting:
+	 * @code
+	 * # lines starting with # or ; are comments
+	 * port = 8080
+	 * name = "two words" second
+	 * verbose
+	 * [log]
+	 * level = 3
+	 * @endcode
+	 * Keys are callees without their leading dashes, prefixed by the section name and a dot within a section, level sets --log.level. 
+	 * Values are split into parameters like Tokenize, a key without = passes the argument without parameters. 
+	 * Load config files after adding all arguments, later files override earlier ones.
+	 * @param Path The path of the config file
+	 * @return ArgumentParser& The argument parser reference
+	 * @throws invalid_argument exception if the file can not be read, a key does not exist or a value has an unclosed quote
+	 */
+	ArgumentParser& ConfigFile(const std::string& Path){
+		const std::unordered_map<std::string_view, Argument*> SettingIndex = BuildSettingIndex();
+		auto File = std::make_shared<const MappedFile>(Path);
+		TransientUnescape Unescaped;
+		std::string Section;
+		std::string Key;
+		bool retained = false;
+		const char* p = File->data();
+		const char* const end = p + File->size();
+		// The values are added to a copy of the sources that replaces them once the whole file loaded, so a file that fails to load adds no values. 
+		// Parse results and published settings viewing the current sources share ownership of them
+		std::vector<SourceValues> Config = ConfigValues, Environment = EnvironmentValues;
+		std::shared_ptr<SourceTokens> Built = CopySources({&Config, &Environment});
+		for(std::size_t LineNumber = 1; p != end; LineNumber++){
+			const char* LineEnd = static_cast<const char*>(std::memchr(p, '\n', end - p));
+			if(!LineEnd)
+				LineEnd = end;
+			std::string_view Line(p, LineEnd - p);
+			p = LineEnd == end ? end : LineEnd + 1;
+			Line = TrimWhitespace(Line);
+			if(Line.empty() || Line[0] == '#' || Line[0] == ';')
+				continue;
+			if(Line[0] == '['){
+				const std::size_t Close = Line.find(']');
+				if(Close == std::string_view::npos)
+					throw std::invalid_argument(Path + ":" + std::to_string(LineNumber) + ": section is not closed");
+				Section = TrimWhitespace(Line.substr(1, Close - 1));
+				continue;
+			}
+			const std::size_t Equals = Line.find('=');
+			const std::string_view Name = TrimWhitespace(Line.substr(0, Equals));
+			Key = Section.empty() ? std::string(Name) : Section + "." + std::string(Name);
+			auto it = SettingIndex.find(Key);
+			if(it == SettingIndex.end())
+				throw std::invalid_argument(Path + ":" + std::to_string(LineNumber) + ": unknown setting " + Key);
+			SourceValues Values{it->second, TokenSpan{Built->Parameters.size(), 0}};
+			if(Equals != std::string_view::npos){
+				const char* v = Line.data() + Equals + 1;
+				const char* const ValueEnd = Line.data() + Line.size();
+				std::string_view Token;
+				try{
+					while(ReadToken<DefaultScan>(v, ValueEnd, Unescaped, Token)){
+						if(Token.data() >= File->data() && Token.data() < end)
+							retained = true;
+						else
+							Token = StoreToken(Built->Storage, Token);
+						Built->Parameters.push_back(Token);
+					}
+				}
+				catch(const std::invalid_argument& e){
+					throw std::invalid_argument(Path + ":" + std::to_string(LineNumber) + ": " + e.what());
+				}
+			}
+			Values.Span.count = Built->Parameters.size() - Values.Span.first;
+			Config.push_back(Values);
+		}
+		if(retained)
+			Built->Storage.Files.push_back(std::move(File));
+		Sources = std::move(Built);
+		ConfigValues = std::move(Config);
+		EnvironmentValues = std::move(Environment);
+		ConfigPaths.push_back(Path);
+		return *this;
+	}
+
+	/**
+	 * @brief Loads the values of arguments from environment variables
+	 * Every callee maps to a variable named Prefix followed by the callee without leading dashes in upper case, with - and . replaced by _. 
+	 * e.g. with prefix MYAPP_ --log-level is set by MYAPP_LOG_LEVEL. Values are split into parameters like Tokenize.
+	 * Environment values override config files and are overridden by the command line, they are used like passed arguments, see ConfigFile.
+	 * The environment is read once by this call in a single pass, variables with the prefix that match no argument are ignored. 
+	 * Calling it again replaces the environment values of the previous call, if a value fails to load the previous values are kept.
+	 * Call it after adding all arguments.
+	 * @param Prefix The prefix of the variables, e.g. MYAPP_
+	 * @return ArgumentParser& The argument parser reference
+	 * @throws invalid_argument exception if a value has an unclosed quote
+	 */
+	ArgumentParser& EnvironmentPrefix(const std::string& Prefix){
+		// The values are built into new sources holding the config values and the environment of this call only, 
+		// so repeated calls do not keep copies of the previous environment and a failing call changes nothing
+		std::vector<SourceValues> Config = ConfigValues, Environment;
+		std::shared_ptr<SourceTokens> Built = CopySources({&Config});
+		// the variable name of every callee
+		std::unordered_map<std::string, Argument*> VariableIndex;
+		for(const auto& Setting : BuildSettingIndex()){
+			std::string Variable = Prefix;
+			for(char c : Setting.first)
+				Variable += (c == '-' || c == '.') ? '_' : static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+			VariableIndex.emplace(std::move(Variable), Setting.second);
+		}
+		auto AddVariable = [&](std::string_view Name, const char* Value){
+			auto it = VariableIndex.find(std::string(Name));
+			if(it == VariableIndex.end())
+				return;
+			SourceValues Values{it->second, TokenSpan{Built->Parameters.size(), 0}};
+			TransientUnescape Unescaped;
+			const char* v = Value;
+			const char* const ValueEnd = Value + std::strlen(Value);
+			std::string_view Token;
+			try{
+				while(ReadToken<DefaultScan>(v, ValueEnd, Unescaped, Token))
+					Built->Parameters.push_back(StoreToken(Built->Storage, Token)); // the environment may change, keep a copy
+			}
+			catch(const std::invalid_argument& e){
+				throw std::invalid_argument(std::string(Name) + ": " + e.what());
+			}
+			Values.Span.count = Built->Parameters.size() - Values.Span.first;
+			Environment.push_back(Values);
+		};
+#ifdef ARGPAR_POSIX
+		for(char** Variable = environ; *Variable; Variable++){
+			const std::string_view Entry(*Variable);
+			const std::size_t Equals = Entry.find('=');
+			if(Equals != std::string_view::npos && Entry.compare(0, Prefix.size(), Prefix) == 0)
+				AddVariable(Entry.substr(0, Equals), *Variable + Equals + 1);
+		}
+#else
+		for(const auto& Variable : VariableIndex)
+			if(const char* Value = std::getenv(Variable.first.c_str()))
+				AddVariable(Variable.first, Value);
+#endif
+		// parse results and published settings viewing the previous sources share ownership of them
+		Sources = std::move(Built);
+		ConfigValues = std::move(Config);
+		EnvironmentValues = std::move(Environment);
+		EnvironmentVariablePrefix = Prefix;
+		return *this;
+	}
+
+	/**
+	 * @brief Gets the help page displayed by -h
+	 * The page is rendered once and cached until an argument is added or changed, or the width changes.
+	 * @return std::string The default usage followed by the help of every argument
+	 */
+	std::string HelpPage() const {
+		std::lock_guard<std::mutex> Lock(HelpMutex);
+		UpdateHelpCache(true);
+		return CachedHelp.Page;
+	}
+
+	/**
+	 * @brief Gets the help of a subset of the arguments
+	 * 
+	 * @param Callees A callee of every argument to include, in the order they are displayed
+	 * @return std::string The help of the given arguments
+	 * @throws invalid_argument exception if a callee does not exist
+	 */
+	std::string HelpPage(const std::vector<std::string_view>& Callees) const {
+		std::vector<const Argument*> Args;
+		Args.reserve(Callees.size());
+		for(std::string_view Callee : Callees){
+			const Argument* _Arg = FindCallee(Callee);
+			if(!_Arg)
+				throw std::invalid_argument(std::string(Callee) + " argument does not exist");
+			Args.push_back(_Arg);
+		}
+		std::string Page;
+		RenderHelpPage(Page, Args, HelpColumns ? HelpColumns : TerminalWidth());
+		return Page;
+	}
+
+	/**
+	 * @brief Writes the help page in a single write, see HelpPage()
+	 * 
+	 * @param os The output stream to write to
+	 */
+	void PrintHelp(std::ostream& os = std::cout) const {
+		std::lock_guard<std::mutex> Lock(HelpMutex);
+		UpdateHelpCache(true);
+		os.write(CachedHelp.Page.data(), static_cast<std::streamsize>(CachedHelp.Page.size()));
+		os.flush();
+	}
+
+	/**
+	 * @brief Writes the help of a subset of the arguments in a single write, see HelpPage(Callees)
+	 * 
+	 * @param Callees A callee of every argument to include
+	 * @param os The output stream to write to
+	 * @throws invalid_argument exception if a callee does not exist
+	 */
+	void PrintHelp(const std::vector<std::string_view>& Callees, std::ostream& os = std::cout) const {
+		const std::string Page = HelpPage(Callees);
+		os.write(Page.data(), static_cast<std::streamsize>(Page.size()));
+		os.flush();
+	}
+
+	/**
+	 * @brief Reports the memory used by the arguments, their strings and the callee index
+	 * 
+	 * @return MemoryReport The bytes per part, see MemoryReport::BytesPerArgument
+	 */
+	MemoryReport MemoryUsage() const {
+		MemoryReport Usage;
+		Usage.Arguments = Arguments.size();
+		Usage.ArgumentBytes = Arguments.size() * sizeof(Argument);
+		for(const Argument& Arg : Arguments)
+			if(Arg._Extras)
+				Usage.ArgumentBytes += sizeof(Argument::Extras) + Arg._Extras->Dependencies.capacity() * sizeof(std::size_t) 
+									 + Arg._Extras->Values.capacity() * sizeof(std::string);
+		Usage.TableBytes = Table.Bytes();
+		Usage.StringBytes = Table.Strings.Bytes(); // includes the parameter string arrays, which are allocated from the pool
+		Usage.Strings = Table.Strings.size();
+		// a node of the callee index holds the key, value, cached hash and next pointer
+		Usage.IndexBytes = CalleeIndex.bucket_count() * sizeof(void*) 
+						 + CalleeIndex.size() * (sizeof(std::pair<const std::string_view, std::uint32_t>) + sizeof(void*) + sizeof(std::size_t)) 
+						 + ArgumentList.capacity() * sizeof(Argument*) + sizeof(ShortCalleeIndex);
+		return Usage;
+	}
+
+	/**
+	 * @brief Adds an argument to the list of arguments
+	 * @note Callee1 and Callee2 should not be the same length! If two callees are used one should be a single character and the other a multicharacter. Order does not matter.
+	 * @tparam ParamTypes The Argument data types
+	 * @param Callee1 First Possible Argument Callee, Single character prefix with -, multi character prefix with --
+	 * @param Callee2 Second Possible Argument Callee, Single character prefix with -, multi character prefix with --
+	 * @return Argument& The argument reference
+	 * @throws runtime_error exception if a callee is already used
+	 */
+	template<typename ...ParamTypes>
+	Argument& addArgument(std::string Callee1, std::string Callee2 = ""){
+		static_assert(sizeof...(ParamTypes) > 0, "addArgument Requires atleast 1 template parameter");
+		static_assert(std::conjunction<supports_conversion<ParamTypes>...>::value, "addArgument parameter types need a registered ArgPar::Converter, "
+			"FastConvert or an istream >> operator");
+		auto CalleeFormatValidator = [](const std::string& Callee){
+			return (Callee.size() == 0) || (Callee.size() == 2 && Callee[0] == '-' && Callee[1] != '-' && !std::isdigit(Callee[1])) || (Callee.size() > 2 && Callee[0] == '-' && Callee[1] == '-' && !isdigit(Callee[3]));
+		};
+		if(!CalleeFormatValidator(Callee1) || !CalleeFormatValidator(Callee2) || (Callee1.size() == Callee2.size()))
+			throw std::invalid_argument("Argument callee does not follow format: Single character arguments should start with prefix -, multi character arguments should start with prefix --");		
+		// If a second callee is given sort based on length
+		if(!Callee2.empty())
+			if(Callee2.size() < Callee1.size()) // make sure Callee1 is the shortest
+				std::swap(Callee1, Callee2);
+
+		if(FindCallee(Callee1) || (!Callee2.empty() && FindCallee(Callee2)))
+			throw std::runtime_error("Insertion of argument failed, maybe the Callee is already used.");
+		Argument& _Arg = Arguments.emplace_back(Table, sizeof...(ParamTypes), Callee1, Callee2);
+		_Arg._Parser = this;
+		ArgumentList.push_back(&_Arg);
+		RequiredArguments.Resize(ArgumentList.size());
+		for(std::size_t c = 0; c < _Arg.CalleeCount(); c++){
+			const std::string_view Callee = _Arg.Callees[c];
+			if(Callee.size() == 2)
+				ShortCalleeIndex[static_cast<unsigned char>(Callee[1])] = &_Arg;
+			else
+				CalleeIndex.emplace(Callee, _Arg._index);
+		}
+		_Arg.InitParamNamesDefault<0, ParamTypes...>();
+		_Arg._f_ConvertTyped = &TypedValues<ParamTypes...>::FromStrings;
+		return _Arg;
+	}
+
+	/**
+	 * @brief Adds a flag to the list of arguments
+	 * 
+	 * @param Callee1 First Possible Argument Callee, Single character prefix with -, multi character prefix with --
+	 * @param Callee2 Second Possible Argument Callee, Single character prefix with -, multi character prefix with --
+	 * @return Argument& The argument reference
+	 */
+	Argument& addFlag(std::string Callee1, std::string Callee2 = ""){
+		Argument* _flag = &addArgument<bool>(Callee1, Callee2)
+			.ImplicitValue(true)
+			.DefaultValue(false);
+		_flag->Set(ArgumentFlag::IsFlag);
+		return *_flag;
+	}
+
+	/**
+	 * @brief Construct a new Argument Parser object
+	 * 
+	 * @param ProgramName The programname 
+	 * @param Major Major version
+	 * @param Minor Minor version
+	 */
+	ArgumentParser(std::string ProgramName, std::size_t Major, std::size_t Minor) : ProgramName(ProgramName){
+		Version[0] = Major;
+		Version[1] = Minor;
+
+		addFlag("-V", "--Version")
+			.Action([&]
+				(const std::vector<std::string>&){
+				std::cout << "Software version: " << ArgumentParser::Version[0] << "." 
+					<< ArgumentParser::Version[1] << std::endl;
+				exit(0);
+				}, false)
+			.Help("Displays the software version")
+			.ParseAlways()
+			.priority(std::numeric_limits<std::size_t>::max());
+		addFlag("-h", "--help")
+			.Action([&]
+				(const std::vector<std::string>&){
+					PrintHelp();
+					exit(0);
+				}, false)
+			.Help("Displays this message")
+			.ParseAlways()
+			.priority(std::numeric_limits<std::size_t>::max());
+	}
+
+	/**
+	 * @brief Parses the command line arguments into the arguments
+	 * Resets the values of a previous call. The parameter values view the strings in argv, which should outlive the arguments. argv passed to main always does.
+	 * @param argc The given argument count
+	 * @param argv The list of argument values
+	 * 
+	 * @throws invalid_argument exception if a passed argument is unknown
+	 * @throws out_of_range exception if a compound argument list does not contain enough parameters
+	 * @throws MissingRequiredParameter if any required parameters are missing
+	 * @throws ConstraintViolation if the passed arguments violate a constraint, see MutuallyExclusive
+	 */
+	void ParseArguments(const int argc, const char** argv){
+		NoInstrumentation Instr;
+		ParseArguments(argc, argv, Instr);
+	}
+
+	/**
+	 * @brief Parses the command line arguments into the arguments while reporting to an instrumentation policy
+	 * @param argc The given argument count
+	 * @param argv The list of argument values
+	 * @param Instr The instrumentation, e.g. a ParseInstrumentation collecting per phase timings and counters
+	 * @see ParseArguments(argc, argv)
+	 */
+	template<typename Instrumentation>
+	void ParseArguments(const int argc, const char** argv, Instrumentation& Instr){
+		HandleCompletion(argc, argv);
+		ArrayTokenSource<const char*> Tokens(argc > 0 ? argv + 1 : argv, argv + argc); // skip the program name
+		ParseArgumentsFrom(Tokens, Instr);
+	}
+
+	/**
+	 * @brief Parses command line tokens into the arguments
+	 * The first token is the program name and is skipped, like argv[0]. Resets the values of a previous call. 
+	 * The parameter values view the tokens, the strings they view should outlive the arguments and the vector itself should outlive Operands() and Values() reads.
+	 * @param Tokens The command line tokens
+	 * 
+	 * @throws invalid_argument exception if a passed argument is unknown
+	 * @throws out_of_range exception if a compound argument list does not contain enough parameters
+	 * @throws MissingRequiredParameter if any required parameters are missing
+	 * @throws ConstraintViolation if the passed arguments violate a constraint, see MutuallyExclusive
+	 */
+	void ParseArguments(const std::vector<std::string_view>& Tokens){
+		NoInstrumentation Instr;
+		ParseArguments(Tokens, Instr);
+	}
+
+	/**
+	 * @brief Parses command line tokens into the arguments while reporting to an instrumentation policy
+	 * @see ParseArguments(const std::vector<std::string_view>&)
+	 */
+	template<typename Instrumentation>
+	void ParseArguments(const std::vector<std::string_view>& Tokens, Instrumentation& Instr){
+		ArrayTokenSource<std::string_view> Source(Tokens.empty() ? Tokens.data() : Tokens.data() + 1, Tokens.data() + Tokens.size()); // skip the program name
+		ParseArgumentsFrom(Source, Instr);
+	}
+
+	/**
+	 * @brief Splits a command line string into tokens and parses them into the arguments
+	 * The command line is split following POSIX shell quoting rules, see Tokenize. The first token is the program name. 
+	 * Parameter values without quotes or escapes view CommandLine, which should outlive the arguments.
+	 * @param CommandLine The command line to parse
+	 * 
+	 * @throws invalid_argument exception if a quote is not closed, the command line ends with a backslash or a passed argument is unknown
+	 * @throws out_of_range exception if a compound argument list does not contain enough parameters
+	 * @throws MissingRequiredParameter if any required parameters are missing
+	 * @throws ConstraintViolation if the passed arguments violate a constraint, see MutuallyExclusive
+	 */
+	void ParseCommandLine(std::string_view CommandLine){
+		NoInstrumentation Instr;
+		ParseCommandLine(CommandLine, Instr);
+	}
+
+	/**
+	 * @brief Splits a command line string into tokens and parses them into the arguments while reporting to an instrumentation policy
+	 * @see ParseCommandLine(std::string_view)
+	 */
+	template<typename Instrumentation>
+	void ParseCommandLine(std::string_view CommandLine, Instrumentation& Instr){
+		std::vector<std::string_view> Tokens;
+		std::unique_ptr<char[]> Storage;
+		{
+			typename Instrumentation::Timer TokenizeTimer(Instr, ParsePhase::Tokenize);
+			Tokenize(CommandLine, Tokens, Storage);
+		}
+		CommandLineStorage = std::move(Storage);
+		CommandLineTokens = std::move(Tokens); // viewed by the operands and value ranges
+		ParseArguments(CommandLineTokens, Instr);
+	}
+
+	/**
+	 * @brief Parses the command line arguments without modifying the parser
+	 * Multiple threads can parse against the same parser concurrently, as long as no arguments are added meanwhile.
+	 * Validators and actions are still called and should be thread safe themselves.
+	 * @param argc The given argument count
+	 * @param argv The list of argument values
+	 * @return ParseResult The values of all arguments, these view the strings in argv
+	 * 
+	 * @throws invalid_argument exception if a passed argument is unknown
+	 * @throws out_of_range exception if a compound argument list does not contain enough parameters
+	 * @throws MissingRequiredParameter if any required parameters are missing
+	 * @throws ConstraintViolation if the passed arguments violate a constraint, see MutuallyExclusive
+	 */
+	ParseResult Parse(const int argc, const char** argv) const {
+		NoInstrumentation Instr;
+		return Parse(argc, argv, Instr);
+	}
+
+	/**
+	 * @brief Parses the command line arguments without modifying the parser while reporting to an instrumentation policy
+	 * @see Parse(argc, argv)
+	 */
+	template<typename Instrumentation>
+	ParseResult Parse(const int argc, const char** argv, Instrumentation& Instr) const {
+		ArrayTokenSource<const char*> Tokens(argc > 0 ? argv + 1 : argv, argv + argc); // skip the program name
+		return ParseFrom(Tokens, Instr);
+	}
+
+	/**
+	 * @brief Parses command line tokens without modifying the parser, see Parse(argc, argv)
+	 * The first token is the program name and is skipped, like argv[0].
+	 * @param Tokens The command line tokens, the strings they view should outlive the result, the vector itself as long as Operands() and Values() are read
+	 * @return ParseResult The values of all arguments
+	 */
+	ParseResult Parse(const std::vector<std::string_view>& Tokens) const {
+		NoInstrumentation Instr;
+		return Parse(Tokens, Instr);
+	}
+
+	/**
+	 * @brief Parses command line tokens without modifying the parser while reporting to an instrumentation policy
+	 * @see Parse(const std::vector<std::string_view>&)
+	 */
+	template<typename Instrumentation>
+	ParseResult Parse(const std::vector<std::string_view>& Tokens, Instrumentation& Instr) const {
+		ArrayTokenSource<std::string_view> Source(Tokens.empty() ? Tokens.data() : Tokens.data() + 1, Tokens.data() + Tokens.size()); // skip the program name
+		return ParseFrom(Source, Instr);
+	}
+
+	/**
+	 * @brief Parses the command line arguments like Parse, returning errors of the passed tokens instead of throwing them
+	 * The scan allocates like a successful parse up to the failing token, the error itself only records that token, the message and 
+	 * suggestions are formatted when read. 
+	 * Exceptions of response files, actions and typed conversions are still thrown.
+	 * @param argc The given argument count
+	 * @param argv The list of argument values
+	 * @return ParseOutcome The values of all arguments if parsing succeeded, otherwise the ParseError
+	 */
+	ParseOutcome TryParse(const int argc, const char** argv) const {
+		NoInstrumentation Instr;
+		return TryParse(argc, argv, Instr);
+	}
+
+	/**
+	 * @brief Parses the command line arguments without throwing for errors while reporting to an instrumentation policy
+	 * @see TryParse(argc, argv)
+	 */
+	template<typename Instrumentation>
+	ParseOutcome TryParse(const int argc, const char** argv, Instrumentation& Instr) const {
+		ArrayTokenSource<const char*> Tokens(argc > 0 ? argv + 1 : argv, argv + argc); // skip the program name
+		return TryParseFrom(Tokens, Instr);
+	}
+
+	/**
+	 * @brief Parses command line tokens without throwing for errors, see TryParse(argc, argv)
+	 * The first token is the program name and is skipped, like argv[0].
+	 */
+	ParseOutcome TryParse(const std::vector<std::string_view>& Tokens) const {
+		NoInstrumentation Instr;
+		return TryParse(Tokens, Instr);
+	}
+
+	/**
+	 * @brief Parses command line tokens without throwing for errors while reporting to an instrumentation policy
+	 * @see TryParse(const std::vector<std::string_view>&)
+	 */
+	template<typename Instrumentation>
+	ParseOutcome TryParse(const std::vector<std::string_view>& Tokens, Instrumentation& Instr) const {
+		ArrayTokenSource<std::string_view> Source(Tokens.empty() ? Tokens.data() : Tokens.data() + 1, Tokens.data() + Tokens.size()); // skip the program name
+		return TryParseFrom(Source, Instr);
+	}
+
+	/**
+	 * @brief Publishes the values of a parse to the ArgumentHandle readers, replacing the published settings
+	 * Every value is converted to the types of its argument once, handles read them without converting or allocating. 
+	 * Readers on other threads keep reading the previous settings until they pin the new ones, they never block or see a partial update. 
+	 * Publish from a single thread, it waits until no reader pins the previous settings, so it should not be called while the calling thread pins them. 
+	 * Values of subcommands are not published.
+	 * @param Result The result of a parse by this parser, the strings it views like argv should outlive the published settings
+	 * @throws invalid_argument exception if the result is of another parser
+	 * @throws ArgumentConversionException if a value can not be converted to its type
+	 */
+	void Publish(ParseResult Result){
+		if(Result.Parser != this)
+			throw std::invalid_argument("Parse result of another parser can not be published by " + ProgramName);
+		auto Snapshot = std::make_unique<SettingsSnapshot>();
+		Snapshot->Entries.resize(ArgumentList.size());
+		std::vector<std::string_view> Views;
+		for(std::size_t i = 0; i < ArgumentList.size(); i++){
+			const Argument& _Arg = *ArgumentList[i];
+			const ParsedValues& Values = Result.Get(i);
+			SettingsSnapshot::Entry& Entry = Snapshot->Entries[i];
+			Entry.Passed = Values.is_used;
+			if(!_Arg.ParamCount())
+				continue;
+			if(Values.typed)
+				Entry.Values = Values.typed;
+			else if(!Values.is_used && _Arg._Extras && _Arg._Extras->TypedDefaults)
+				Entry.Values = _Arg._Extras->TypedDefaults;
+			else if(Values.is_used || _Arg.Has(ArgumentFlag::DefaultValues)){
+				Views.resize(_Arg.ParamCount());
+				for(std::size_t k = 0; k < Views.size(); k++)
+					Views[k] = _Arg.ParamView(Values, k);
+				// a variadic argument may miss parameters without defaults
+				if(std::none_of(Views.begin(), Views.end(), [](std::string_view View){return View.data() == nullptr;}))
+					Entry.Values = _Arg._f_ConvertTyped(Views.data());
+			}
+		}
+		Snapshot->Storage = std::move(Result.Storage);
+		Snapshot->Sources = std::move(Result.Sources);
+		Snapshot->_Version = ++PublishCount;
+		Published.Publish(std::move(Snapshot));
+	}
+
+	/**
+	 * @brief Parses the command line arguments and publishes their values, see Publish(ParseResult)
+	 * A reload parses the arguments again, after ReloadSources to pick up changed config files and environment variables. 
+	 * If parsing fails the exception is thrown and the published settings are kept.
+	 */
+	void Publish(const int argc, const char** argv){
+		Publish(Parse(argc, argv));
+	}
+
+	/**
+	 * @brief Parses command line tokens and publishes their values, see Publish(ParseResult)
+	 */
+	void Publish(const std::vector<std::string_view>& Tokens){
+		Publish(Parse(Tokens));
+	}
+
+	/**
+	 * @brief Pins the published settings, they are not replaced for this reader while it holds the pin
+	 * Read several handles from one pin to read values of the same parse, e.g. Port.Get(Settings). Pinning never blocks or allocates.
+	 * @return PinnedSettings The pinned settings
+	 * @throws logic_error exception if no settings were published yet
+	 */
+	PinnedSettings Settings() const {
+		PinnedSettings Pinned = Published.Read();
+		if(!Pinned.operator->())
+			throw std::logic_error("No settings of " + ProgramName + " were published, call Publish first");
+		return Pinned;
+	}
+
+	/**
+	 * @brief Reads the loaded config files and the environment variables again, see ConfigFile and EnvironmentPrefix
+	 * Parse results, committed values and published settings keep viewing the previous values, parse or publish again to use the reloaded values. 
+	 * If a source fails to load the exception is thrown and the previous values are kept. Do not parse on other threads while reloading.
+	 * Config files are memory mapped and viewed by the values, replace a file by renaming a new file over it rather than writing it in place.
+	 * @return ArgumentParser& The argument parser reference
+	 * @throws invalid_argument exception if a config file can not be read or is invalid, see ConfigFile
+	 */
+	ArgumentParser& ReloadSources(){
+		// the previous sources stay alive as long as parse results, committed values or published settings view them
+		std::vector<SourceValues> PreviousConfig = std::move(ConfigValues), PreviousEnvironment = std::move(EnvironmentValues);
+		std::shared_ptr<SourceTokens> PreviousSources = std::exchange(Sources, std::make_shared<SourceTokens>());
+		std::vector<std::string> Paths = std::move(ConfigPaths);
+		ConfigValues.clear();
+		EnvironmentValues.clear();
+		ConfigPaths.clear();
+		try{
+			for(const std::string& Path : Paths)
+				ConfigFile(Path);
+			if(EnvironmentVariablePrefix)
+				EnvironmentPrefix(std::string(*EnvironmentVariablePrefix));
+		}
+		catch(...){
+			ConfigValues = std::move(PreviousConfig);
+			EnvironmentValues = std::move(PreviousEnvironment);
+			Sources = std::move(PreviousSources);
+			ConfigPaths = std::move(Paths);
+			throw;
+		}
 		return *this;
 	}
-	
-	/**
-	 * @brief Sets a custom validator function. 
-	 * Gets called at the beginning of an arguments parsing function. Should return 0 if validation is passed otherwise the position of the argument that did not pass the validator check
-	 * @param Validator The function of the custom validator
-	 * @return Argument& The argument reference
-	 */
-	Argument& Validator(std::function<std::size_t(const std::vector<std::string>&)> Validator){
-		_f_ParameterParserValidator = Validator;
-		return *this;
+
+private:
+	// Stores the values of a parse result in the arguments, later values of an argument overwrite earlier ones
+	void Commit(ParseResult& Result){
+		for(Argument* _Arg : ArgumentList)
+			_Arg->_Values = ParsedValues();
+		for(auto& Entry : Result.Values)
+			ArgumentList[Entry.first]->_Values = std::move(Entry.second);
+		for(Argument* _Arg : ArgumentList)
+			_Arg->_ValueRange = TokenRange();
+		for(auto& Entry : Result.ValueRanges)
+			ArgumentList[Entry.first]->_ValueRange = std::move(Entry.second);
+		_Operands = std::move(Result._Operands);
+		ResponseFileStorage = std::move(Result.Storage);
+		CommittedSources = std::move(Result.Sources);
+		SelectedSubcommand = Result._SubcommandName;
+		if(Result._Subcommand)
+			Subcommand(SelectedSubcommand).Commit(*Result._Subcommand);
+	}
+
+	// Parses the tokens into Result, expanding response files if enabled. Retained tokens of response files are kept in Result, see ParseInto
+	template<typename Source, typename Instrumentation>
+	ParseError ParseExpanded(Source& Tokens, ParseResult& Result, Instrumentation& Instr) const {
+		if(ExpandResponseFiles){
+			ResponseFileTokenSource<Source> Expanded(Tokens, Result.Storage);
+			return ParseInto(Expanded, Result, Instr);
+		}
+		return ParseInto(Tokens, Result, Instr);
+	}
+
+	// Parses the tokens into the arguments, see ParseArguments
+	template<typename Source, typename Instrumentation>
+	void ParseArgumentsFrom(Source& Tokens, Instrumentation& Instr){
+		ParseResult Result(*this);
+		ParseError Error;
+		try{
+			Error = ParseExpanded(Tokens, Result, Instr);
+		}
+		catch(...){
+			Commit(Result); // arguments parsed before the failure keep their values
+			throw;
+		}
+		Commit(Result);
+		Error.Throw();
+	}
+
+	// Parses the tokens into a new result, see Parse
+	template<typename Source, typename Instrumentation>
+	ParseResult ParseFrom(Source& Tokens, Instrumentation& Instr) const {
+		ParseResult Result(*this);
+		ParseExpanded(Tokens, Result, Instr).Throw();
+		Result.Finalize();
+		return Result;
+	}
+
+	// Parses the tokens into a new result or error, see TryParse
+	template<typename Source, typename Instrumentation>
+	ParseOutcome TryParseFrom(Source& Tokens, Instrumentation& Instr) const {
+		ParseResult Result(*this);
+		ParseError Error = ParseExpanded(Tokens, Result, Instr);
+		if(!Error)
+			Result.Finalize();
+		return ParseOutcome(std::move(Result), std::move(Error));
+	}
+
+	// An argument to parse with its parameters, see Schedule
+	struct ArgumentTask {
+		Argument* Arg;
+		TokenSpan Span;
+	};
+
+	// The parse order of the passed arguments, by priority level and the dependencies within a level
+	struct ArgumentSchedule {
+		std::vector<ArgumentTask> Tasks;
+		// End of every priority level in Tasks, a level is parsed once the levels before it completed
+		std::vector<std::size_t> LevelEnds;
+		// Tasks of the same level waiting for a task, and the amount of tasks a task waits for
+		std::vector<std::vector<std::size_t>> Dependents;
+		std::vector<std::size_t> Waiting;
+	};
+
+	// Orders the arguments of every level such that dependencies are parsed first, otherwise in parse order
+	template<typename Entries>
+	ArgumentSchedule Schedule(const Entries& Data) const {
+		ArgumentSchedule S;
+		S.Tasks.reserve(Data.size());
+		for(const auto& _Argument : Data){
+			if(!S.Tasks.empty() && S.Tasks.back().Arg->Priority() != _Argument.second.first->Priority())
+				S.LevelEnds.push_back(S.Tasks.size());
+			S.Tasks.push_back(ArgumentTask{_Argument.second.first, _Argument.second.second});
+		}
+		S.LevelEnds.push_back(S.Tasks.size());
+		S.Dependents.resize(S.Tasks.size());
+		S.Waiting.assign(S.Tasks.size(), 0);
+		if(!DependencyCount)
+			return S;
+
+		std::vector<std::size_t> Order;
+		Order.reserve(S.Tasks.size());
+		std::size_t LevelBegin = 0;
+		for(std::size_t LevelEnd : S.LevelEnds){
+			// Occurrences of every argument in the level
+			std::vector<std::pair<std::size_t, std::size_t>> Occurrences;
+			for(std::size_t i = LevelBegin; i < LevelEnd; i++)
+				Occurrences.emplace_back(S.Tasks[i].Arg->_index, i);
+			std::sort(Occurrences.begin(), Occurrences.end());
+			for(std::size_t i = LevelBegin; i < LevelEnd; i++){
+				const Argument& Arg = *S.Tasks[i].Arg;
+				for(std::size_t Dependency : Arg.Dependencies()){
+					if(ArgumentList[Dependency]->Priority() < Arg.Priority())
+						throw std::logic_error("Argument " + std::string(Arg.Callees[0]) + " depends on " + std::string(ArgumentList[Dependency]->Callees[0]) + " which has a lower priority");
+					for(auto it = std::lower_bound(Occurrences.begin(), Occurrences.end(), std::make_pair(Dependency, std::size_t(0))); 
+						it != Occurrences.end() && it->first == Dependency; ++it){
+						S.Dependents[it->second].push_back(i);
+						S.Waiting[i]++;
+					}
+				}
+			}
+			// Take the first ready task in parse order until the level is ordered
+			std::vector<std::size_t> Count(S.Waiting.begin() + LevelBegin, S.Waiting.begin() + LevelEnd);
+			std::priority_queue<std::size_t, std::vector<std::size_t>, std::greater<std::size_t>> Ready;
+			for(std::size_t i = LevelBegin; i < LevelEnd; i++)
+				if(!Count[i - LevelBegin])
+					Ready.push(i);
+			const std::size_t Ordered = Order.size();
+			while(!Ready.empty()){
+				const std::size_t i = Ready.top();
+				Ready.pop();
+				Order.push_back(i);
+				for(std::size_t Dependent : S.Dependents[i])
+					if(!--Count[Dependent - LevelBegin])
+						Ready.push(Dependent);
+			}
+			if(Order.size() - Ordered != LevelEnd - LevelBegin){
+				std::vector<std::string> Cycle;
+				for(std::size_t i = LevelBegin; i < LevelEnd; i++)
+					if(Count[i - LevelBegin] && std::find(Cycle.begin(), Cycle.end(), S.Tasks[i].Arg->Callees[0]) == Cycle.end())
+						Cycle.emplace_back(S.Tasks[i].Arg->Callees[0]);
+				throw std::logic_error("Arguments " + JoinCallees(Cycle) + " depend on each other");
+			}
+			LevelBegin = LevelEnd;
+		}
+
+		// Move the tasks to their position in the order
+		std::vector<std::size_t> Position(Order.size());
+		for(std::size_t i = 0; i < Order.size(); i++)
+			Position[Order[i]] = i;
+		ArgumentSchedule Sorted;
+		Sorted.LevelEnds = std::move(S.LevelEnds);
+		Sorted.Tasks.reserve(Order.size());
+		Sorted.Dependents.resize(Order.size());
+		Sorted.Waiting.resize(Order.size());
+		for(std::size_t i = 0; i < Order.size(); i++){
+			Sorted.Tasks.push_back(S.Tasks[Order[i]]);
+			Sorted.Waiting[i] = S.Waiting[Order[i]];
+			for(std::size_t Dependent : S.Dependents[Order[i]])
+				Sorted.Dependents[i].push_back(Position[Dependent]);
+		}
+		return Sorted;
+	}
+
+	/**
+	 * @brief Parses the parameters of the arguments by priority, on ActionThreads threads if set
+	 * Concurrently parsed arguments end the same as serially parsed ones: the error of the first argument in parse order that failed is returned
+	 * or, if its action threw, thrown, and only the values of the arguments parsed before it are kept. Arguments after it in the same level may have run already.
+	 * @return ParseError The MissingParameters or ValidatorFailed error of the first argument that failed, None if all were parsed
+	 */
+	template<typename Entries, typename Instrumentation>
+	ParseError RunArguments(const Entries& Data, const std::vector<std::string_view>& Parameters, ParseResult& Result, Instrumentation& Instr) const {
+		std::size_t Position = 0;
+		if(!DependencyCount && ActionThreads < 2){
+			for(const auto& _Argument : Data){
+				const Argument& Arg = *_Argument.second.first;
+				const TokenSpan& Span = _Argument.second.second;
+				if(const ParseErrc Code = Arg._TryParseArg(Parameters.data() + Span.first, Span.count, Result.Add(Arg._index), Position, Instr); Code != ParseErrc::None)
+					return ParseError(Code, *this, &Arg, {}, Span.token, Position);
+			}
+			return ParseError();
+		}
+		ArgumentSchedule S = Schedule(Data);
+		const std::size_t TaskCount = S.Tasks.size();
+		const std::size_t Base = Result.Values.size();
+		for(const ArgumentTask& Task : S.Tasks)
+			Result.Add(Task.Arg->_index);
+		auto Run = [&](std::size_t i, std::size_t& Position, Instrumentation& Policy){
+			const ArgumentTask& Task = S.Tasks[i];
+			return Task.Arg->_TryParseArg(Parameters.data() + Task.Span.first, Task.Span.count, Result.Values[Base + i].second, Position, Policy);
+		};
+		auto Failed = [&](std::size_t i, ParseErrc Code, std::size_t Position){
+			Result.Values.erase(Result.Values.begin() + Base + i + 1, Result.Values.end());
+			return ParseError(Code, *this, S.Tasks[i].Arg, {}, S.Tasks[i].Span.token, Position);
+		};
+
+		if(ActionThreads < 2 || TaskCount < 2){
+			for(std::size_t i = 0; i < TaskCount; i++){
+				ParseErrc Code;
+				try {
+					Code = Run(i, Position, Instr);
+				} catch(...){
+					Result.Values.erase(Result.Values.begin() + Base + i + 1, Result.Values.end());
+					throw;
+				}
+				if(Code != ParseErrc::None)
+					return Failed(i, Code, Position);
+			}
+			return ParseError();
+		}
+
+		std::mutex Mutex;
+		std::condition_variable Wake;
+		std::priority_queue<std::size_t, std::vector<std::size_t>, std::greater<std::size_t>> Ready;
+		std::vector<std::exception_ptr> Errors(TaskCount);
+		std::vector<std::pair<ParseErrc, std::size_t>> Codes(TaskCount, {ParseErrc::None, 0}); // errors and validator positions of the tasks
+		std::size_t FirstError = TaskCount; // tasks after it are not started, their values are dropped
+		std::size_t Level = 0;
+		std::size_t Remaining = 0; // tasks of the level that did not complete
+		bool Stop = false;
+		auto StartLevel = [&]{
+			const std::size_t LevelBegin = Level ? S.LevelEnds[Level - 1] : 0;
+			Remaining = S.LevelEnds[Level] - LevelBegin;
+			for(std::size_t i = LevelBegin; i < S.LevelEnds[Level]; i++)
+				if(!S.Waiting[i])
+					Ready.push(i);
+		};
+		auto Work = [&](Instrumentation& Local){
+			std::unique_lock<std::mutex> Lock(Mutex);
+			for(;;){
+				Wake.wait(Lock, [&]{return Stop || !Ready.empty();});
+				if(Ready.empty())
+					return;
+				const std::size_t i = Ready.top();
+				Ready.pop();
+				if(i < FirstError){
+					Lock.unlock();
+					try {
+						Codes[i].first = Run(i, Codes[i].second, Local);
+					} catch(...){
+						Errors[i] = std::current_exception();
+					}
+					Lock.lock();
+					if(Errors[i] || Codes[i].first != ParseErrc::None)
+						FirstError = std::min(FirstError, i);
+				}
+				for(std::size_t Dependent : S.Dependents[i])
+					if(!--S.Waiting[Dependent])
+						Ready.push(Dependent);
+				if(!--Remaining){
+					if(FirstError < TaskCount || ++Level == S.LevelEnds.size())
+						Stop = true;
+					else
+						StartLevel();
+					Wake.notify_all();
+				}
+				else if(!S.Dependents[i].empty())
+					Wake.notify_all();
+			}
+		};
+		StartLevel();
+
+		// Every worker collects into its own instrumentation, the parsing thread works as well
+		const std::size_t WorkerCount = std::min(ActionThreads, TaskCount) - 1;
+		std::vector<Instrumentation> Locals(WorkerCount, Instr);
+		for(Instrumentation& Local : Locals)
+			Local.Reset();
+		std::vector<std::thread> Workers;
+		Workers.reserve(WorkerCount);
+		try {
+			for(std::size_t t = 0; t < WorkerCount; t++)
+				Workers.emplace_back(Work, std::ref(Locals[t]));
+		} catch(const std::system_error&){
+			// Out of threads, the started workers and the parsing thread complete the tasks
+		}
+		Work(Instr);
+		for(std::thread& Worker : Workers)
+			Worker.join();
+		for(const Instrumentation& Local : Locals)
+			Instr += Local;
+
+		if(FirstError == TaskCount)
+			return ParseError();
+		if(Errors[FirstError]){
+			Result.Values.erase(Result.Values.begin() + Base + FirstError + 1, Result.Values.end());
+			std::rethrow_exception(Errors[FirstError]);
+		}
+		return Failed(FirstError, Codes[FirstError].first, Codes[FirstError].second);
+	}
+
+	/**
+	 * @brief Parses the tokens of a source into Result, the values of arguments parsed before a failure are kept in Result
+	 * Tokens are read once in order, a source provides bool Next(std::string_view&) and std::string_view Retain(std::string_view) 
+	 * which makes the last read token outlive the source. Only parameters within the parameter count of their argument are retained,
+	 * so memory use grows with the passed arguments rather than the amount of tokens.
+	 * Errors of the passed tokens are returned rather than thrown, exceptions of sources, actions and typed conversions are still thrown.
+	 * @param TokenIndex The index of the last read token, counted from the program name
+	 * @return ParseError Why parsing failed, None if it succeeded
+	 */
+	template<typename Source, typename Instrumentation>
+	ParseError ParseInto(Source& Tokens, ParseResult& Result, Instrumentation& Instr, std::size_t TokenIndex = 0) const {
+		std::map<
+			std::pair<std::size_t, std::size_t>, 
+			std::pair<Argument*, TokenSpan>,
+			std::greater<std::pair<std::size_t, std::size_t>>> ArgumentData;
+		std::map<
+			std::pair<std::size_t, std::size_t>, 
+			std::pair<Argument*, TokenSpan>,
+			std::greater<std::pair<std::size_t, std::size_t>>> ParseAlwaysArguments;
+		// Retained parameter tokens, indexed by the TokenSpans
+		std::vector<std::string_view> Parameters;
+		// Arguments that were passed, only tracked if required arguments, constraints or configuration sources need it
+		const bool TrackPresent = RequiredCount || !Constraints.empty() || !ConfigValues.empty() || !EnvironmentValues.empty();
+		ArgumentBits Present(TrackPresent ? ArgumentList.size() : 0);
+		auto MarkPresent = [&](std::size_t Index){
+			if(TrackPresent)
+				Present.Set(Index);
+		};
+		// The scan reads the rows of the table, arguments themselves are only read when they are parsed
+		auto Has = [this](std::size_t Index, ArgumentFlag Flag){return Table.Has(Index, Flag);};
+		// The subcommand selected by the first operand, the tokens after it are left to its parser
+		const std::pair<const std::string, SubcommandEntry>* Selected = nullptr;
+		auto SelectSubcommand = [&](std::string_view Operand){
+			auto it = Subcommands.find(Operand);
+			if(it != Subcommands.end())
+				Selected = &*it;
+			return Selected != nullptr;
+		};
+		auto Next = [&](std::string_view& Token){
+			const bool Read = Tokens.Next(Token);
+			TokenIndex += Read;
+			return Read;
+		};
+
+		{
+			typename Instrumentation::Timer ScanTimer(Instr, ParsePhase::Scan);
+			std::size_t w = 0;
+			std::string_view Token;
+			bool hasToken = Next(Token);
+			while(hasToken && !Selected){
+				// check if string starts with -
+				const bool TokenIsArgument = isArgument(Token);
+				Instr.TokenClassified(Token, TokenIsArgument);
+				if(!TokenIsArgument){
+					if(!Subcommands.empty()){
+						if(!SelectSubcommand(Token))
+							return ParseError(ParseErrc::UnknownSubcommand, *this, nullptr, Tokens.Retain(Token), TokenIndex);
+						break;
+					}
+					Tokens.Record(Result._Operands);
+					hasToken = Next(Token);
+					continue;
+				}
+				// single dash with multiple arguments is a compound argument. Disect
+				if(Token[1] != '-' && Token.size() > 2){
+					const std::string_view Compound = Tokens.Retain(Token); // reading the parameters may invalidate Token
+					const std::size_t CompoundIndex = TokenIndex;
+					hasToken = Next(Token);
+					for(std::size_t j = 1; j < Compound.size(); j++){ // j is Compound itterator start at 1 to skip -
+						Argument* Argpos;
+						{
+							typename Instrumentation::Timer LookupTimer(Instr, ParsePhase::Lookup);
+							Argpos = ShortCalleeIndex[static_cast<unsigned char>(Compound[j])];
+						}
+						Instr.LookedUp(Compound, Argpos);
+						if(!Argpos)
+							return ParseError(ParseErrc::UnknownArgument, *this, nullptr, Compound, CompoundIndex, j);
+						const std::size_t Index = Argpos->_index;
+						const std::size_t ParamCount = Table.ParamCounts[Index];
+						const bool Variadic = Has(Index, ArgumentFlag::Variadic);
+						auto insertRef = ArgumentData.insert({{Table.Priorities[Index], w++}, std::make_pair(Argpos, TokenSpan{Parameters.size(), 0, CompoundIndex})}); // add - argument for later parsing.
+						if(!insertRef.second)
+							throw std::runtime_error("Insertion of argument failed, maybe the key is already used.");
+						Instr.Allocated(1);
+						TokenRange* Range = Variadic || Has(Index, ArgumentFlag::Repeatable) ? &Result.AddRange(Index) : nullptr;
+						// every argument takes its parameters in turn, a variadic argument takes all tokens up to the next argument
+						std::size_t l = 0;
+						for(;hasToken && (Variadic || l < ParamCount); l++){
+							if(!TakesParameter(Index, Token))
+								break;
+							if(isArgument(Token)){
+								if(Variadic)
+									break;
+								return ParseError(ParseErrc::MissingParameters, *this, Argpos, Compound, CompoundIndex, j);
+							}
+							Instr.TokenClassified(Token, false);
+							if(l < ParamCount)
+								Parameters.push_back(Tokens.Retain(Token));
+							if(Range)
+								Tokens.Record(*Range);
+							hasToken = Next(Token);
+						}
+						insertRef.first->second.second.count = std::min(l, ParamCount);
+						// add to parseAlways if needed
+						if(Has(Index, ArgumentFlag::ParseAlways)){
+							ParseAlwaysArguments.insert(*insertRef.first);
+							Instr.Allocated(1);
+						}
+						MarkPresent(Index);
+					}
+				}
+				else{
+					// Find argument
+					std::size_t Index;
+					bool Ambiguous = false;
+					{
+						typename Instrumentation::Timer LookupTimer(Instr, ParsePhase::Lookup);
+						Index = LookupIndex(Token, Ambiguous);
+					}
+					Argument* Argpos = Index == NoArgument ? nullptr : ArgumentList[Index];
+					Instr.LookedUp(Token, Argpos);
+					if(!Argpos)
+						return ParseError(Ambiguous ? ParseErrc::AmbiguousArgument : ParseErrc::UnknownArgument, *this, nullptr, Tokens.Retain(Token), TokenIndex);
+					const std::size_t ArgumentIndex = TokenIndex;
+					const std::size_t ParamCount = Table.ParamCounts[Index];
+					MarkPresent(Index);
+					TokenRange* Range = Has(Index, ArgumentFlag::Variadic) || Has(Index, ArgumentFlag::Repeatable) ? &Result.AddRange(Index) : nullptr;
+					const std::size_t first = Parameters.size();
+					// parameters are the following tokens up to the next argument, those beyond the parameter count are operands
+					std::size_t Take = Has(Index, ArgumentFlag::Variadic) ? std::numeric_limits<std::size_t>::max() : ParamCount;
+					std::size_t j = 0;
+					while((hasToken = Next(Token)) && !isArgument(Token)){
+						Instr.TokenClassified(Token, false);
+						if(j < Take && TakesParameter(Index, Token)){
+							if(j < ParamCount)
+								Parameters.push_back(Tokens.Retain(Token));
+							if(Range)
+								Tokens.Record(*Range);
+							j++;
+						}
+						else if(!Subcommands.empty()){
+							if(!SelectSubcommand(Token))
+								return ParseError(ParseErrc::UnknownSubcommand, *this, nullptr, Tokens.Retain(Token), TokenIndex);
+							break;
+						}
+						else{
+							Tokens.Record(Result._Operands);
+							Take = j;
+						}
+					}
+					auto insertRef = ArgumentData.insert({{Table.Priorities[Index], w++}, std::make_pair(Argpos, TokenSpan{first, Parameters.size() - first, ArgumentIndex})});
+					if(!insertRef.second)
+						throw std::runtime_error("Insertion of argument failed, maybe the key is already used.");
+					Instr.Allocated(1);
+					// add to parseAlways if needed
+					if(Has(Index, ArgumentFlag::ParseAlways)){
+						ParseAlwaysArguments.insert(*insertRef.first);
+						Instr.Allocated(1);
+					}
+				}
+			}
+		}
+		// Add the values of configuration sources for arguments that were not passed, the highest precedence first
+		if(!ConfigValues.empty() || !EnvironmentValues.empty()){
+			Result.Sources = Sources;
+			std::size_t w = ArgumentData.size();
+			for(const std::vector<SourceValues>* Layer : {&EnvironmentValues, &ConfigValues}){
+				for(auto it = Layer->rbegin(); it != Layer->rend(); ++it){
+					Argument* Argpos = it->Arg;
+					const std::size_t Index = Argpos->_index;
+					if(Present.Test(Index))
+						continue;
+					MarkPresent(Index);
+					const std::size_t first = Parameters.size();
+					const std::size_t count = Has(Index, ArgumentFlag::Variadic) ? std::min<std::size_t>(it->Span.count, Table.ParamCounts[Index]) : it->Span.count;
+					Parameters.insert(Parameters.end(), Sources->Parameters.begin() + it->Span.first, Sources->Parameters.begin() + it->Span.first + count);
+					if(Has(Index, ArgumentFlag::Variadic) || Has(Index, ArgumentFlag::Repeatable)){
+						TokenRange& Range = Result.AddRange(Index);
+						for(std::size_t k = 0; k < it->Span.count; k++)
+							Range.Add(Sources->Parameters.data() + it->Span.first + k);
+					}
+					auto insertRef = ArgumentData.insert({{Table.Priorities[Index], w++}, std::make_pair(Argpos, TokenSpan{first, count})});
+					Instr.Allocated(1);
+					if(Has(Index, ArgumentFlag::ParseAlways)){
+						ParseAlwaysArguments.insert(*insertRef.first);
+						Instr.Allocated(1);
+					}
+				}
+			}
+		}
+		// Check all required arguments were passed and all constraints hold
+		bool Valid;
+		{
+			typename Instrumentation::Timer RequiredTimer(Instr, ParsePhase::RequiredCheck);
+			Valid = !TrackPresent || Satisfied(Present);
+		}
+		if(!Valid){
+			{
+				typename Instrumentation::Timer ArgumentsTimer(Instr, ParsePhase::Arguments);
+				if(ParseError Error = RunArguments(ParseAlwaysArguments, Parameters, Result, Instr)) // Parse the "parse always" argument regardless of required arguments.
+					return Error;
+			}
+			return ParseError(Present.Covers(RequiredArguments) ? ParseErrc::ConstraintViolated : ParseErrc::MissingRequired, *this, std::move(Present));
+		}
+
+		// Parse the arguments
+		{
+			typename Instrumentation::Timer ArgumentsTimer(Instr, ParsePhase::Arguments);
+			if(ParseError Error = RunArguments(ArgumentData, Parameters, Result, Instr))
+				return Error;
+		}
+
+		// The remaining tokens belong to the subcommand
+		if(Selected){
+			const ArgumentParser& Sub = BuildSubcommand(Selected->first, Selected->second);
+			Result._SubcommandName = Selected->first;
+			Result._Subcommand.reset(new ParseResult(Sub));
+			return Sub.ParseInto(Tokens, *Result._Subcommand, Instr, TokenIndex);
+		}
+		return ParseError();
+	}
+
+public:
+	/**
+	 * @brief Returns a reference to an argument specified by the key
+	 * 
+	 * @param ArgKey The key of the argument
+	 * @return Argument& A reference to the argument
+	 * @throws invalid_argument exception if the argument key does not exist
+	 */
+	Argument& operator[](std::string_view ArgKey){
+		Argument* _Arg = FindCallee(ArgKey);
+		if(!_Arg)
+			throw std::invalid_argument(std::string(ArgKey) + " argument does not exist");
+		return *_Arg;
+	}
+
+	/**
+	 * @brief Gets the operands of the last ParseArguments call, see ParseResult::Operands
+	 * @return const TokenRange& The operands, read from the parsed tokens while iterating
+	 */
+	const TokenRange& Operands() const {return _Operands;}
+};
+
+
+template<typename ...ParamTypes>
+ArgumentHandle<ParamTypes...>::ArgumentHandle(const Argument& Arg) : Parser(Arg._Parser), Index(Arg._index) {
+	if(Arg._f_ConvertTyped != &TypedValues<ParamTypes...>::FromStrings)
+		throw std::logic_error("Argument " + std::string(Arg.Callees[0]) + " does not have the types of the handle");
+}
+
+template<typename ...ParamTypes>
+const TypedValues<ParamTypes...>& ArgumentHandle<ParamTypes...>::Values(const PinnedSettings& Settings) const {
+	const TypedValuesBase* Values = Settings->Entries[Index].Values.get();
+	if(!Values)
+		throw std::logic_error("Argument " + std::string(Parser->ArgumentList[Index]->Callees[0]) + " has no value in the published settings, pass or default the argument");
+	return static_cast<const TypedValues<ParamTypes...>&>(*Values);
+}
+
+template<typename ...ParamTypes>
+template<std::size_t I>
+typename ArgumentHandle<ParamTypes...>::template ParamType<I> ArgumentHandle<ParamTypes...>::Get() const {
+	const PinnedSettings Settings = Parser->Settings();
+	return Get<I>(Settings);
+}
+
+template<typename ...ParamTypes>
+bool ArgumentHandle<ParamTypes...>::Passed() const {
+	const PinnedSettings Settings = Parser->Settings();
+	return Passed(Settings);
+}
+
+inline Argument& Argument::Required(){
+	if(!Has(ArgumentFlag::Required) && _Parser){
+		_Parser->RequiredArguments.Set(_index);
+		_Parser->RequiredCount++;
+	}
+	Set(ArgumentFlag::Required);
+	_revision++;
+	return *this;
+}
+
+inline Argument& Argument::DependsOn(std::string_view Callee){
+	const Argument* Dependency = _Parser ? _Parser->FindCallee(Callee) : nullptr;
+	if(!Dependency)
+		throw std::invalid_argument(std::string(Callee) + " argument does not exist");
+	if(Dependency == this)
+		throw std::invalid_argument("Argument " + std::string(Callees[0]) + " can not depend on itself");
+	std::vector<std::size_t>& Dependencies = MutableExtras().Dependencies;
+	if(std::find(Dependencies.begin(), Dependencies.end(), Dependency->_index) == Dependencies.end()){
+		Dependencies.push_back(Dependency->_index);
+		_Parser->DependencyCount++;
+	}
+	return *this;
+}
+
+inline ParsedArgument ParseResult::operator[](std::string_view ArgKey) const {
+	const Argument* _Arg = Parser->FindCallee(ArgKey);
+	if(!_Arg)
+		throw std::invalid_argument(std::string(ArgKey) + " argument does not exist");
+	return ParsedArgument(*_Arg, Get(_Arg->_index), GetRange(_Arg->_index));
+}
+
+inline std::string ParseError::Callee() const {
+	if(_Argument)
+		return std::string(_Argument->Callees[0]);
+	if((_Code == ParseErrc::UnknownArgument || _Code == ParseErrc::MissingParameters) && Compound())
+		return "-" + std::string(1, _Token[_Position]);
+	return std::string(_Token);
+}
+
+inline std::vector<std::string> ParseError::Callees() const {
+	switch(_Code){
+	case ParseErrc::UnknownArgument:
+		return _Parser->LongCallees().Similar(Compound() ? "-" + std::string(_Token) : std::string(_Token));
+	case ParseErrc::UnknownSubcommand:
+		return _Parser->SubcommandSuggestions(_Token);
+	case ParseErrc::AmbiguousArgument:
+		return _Parser->AbbreviationCandidates(_Token);
+	case ParseErrc::MissingRequired:
+	case ParseErrc::ConstraintViolated:
+		return _Parser->Violation(_Present).Arguments;
+	default:
+		return {};
+	}
+}
+
+inline std::string ParseError::Message() const {
+	switch(_Code){
+	case ParseErrc::None:
+		return {};
+	case ParseErrc::UnknownArgument:
+		return ArgumentParser::UnknownMessage("Unkown console argument: ", Callee(), Callees());
+	case ParseErrc::UnknownSubcommand:
+		return ArgumentParser::UnknownMessage("Unknown subcommand: ", _Token, Callees());
+	case ParseErrc::AmbiguousArgument:
+		return ArgumentParser::AmbiguousMessage(_Token, Callees());
+	case ParseErrc::MissingParameters:
+		if(!_Token.empty())
+			return "Not enough parameters for compound argument " + std::string(_Token) + " use -h for help";
+		return _Argument->MissingParametersMessage();
+	case ParseErrc::ValidatorFailed:
+		return _Argument->ValidatorMessage(_Position);
+	case ParseErrc::MissingRequired:
+	case ParseErrc::ConstraintViolated:
+		return _Parser->Violation(_Present).Message;
+	}
+	return {};
+}
+
+inline void ParseError::Throw() const {
+	switch(_Code){
+	case ParseErrc::None:
+		return;
+	case ParseErrc::UnknownArgument:
+		_Parser->ThrowUnknown(Callee(), Compound() ? "-" + std::string(_Token) : std::string(_Token));
+	case ParseErrc::UnknownSubcommand:
+		_Parser->ThrowUnknownSubcommand(_Token);
+	case ParseErrc::AmbiguousArgument:
+		_Parser->ThrowAmbiguous(_Token);
+	case ParseErrc::MissingParameters:
+		throw std::out_of_range(Message());
+	case ParseErrc::ValidatorFailed:
+		throw ValidatorException(Message(), std::string(_Argument->Callees[0]), _Position);
+	case ParseErrc::MissingRequired:
+	case ParseErrc::ConstraintViolated:
+		_Parser->ThrowViolation(_Present);
+	}
+}
+
+//?==== Batch parsing ====?//
+
+/**
+ * @brief The outcome of parsing a single line of a batch
+ * Either Result is set or Error holds the exception ParseArguments would have thrown for the line.
+ */
+struct BatchLineResult {
+	// The line without its line ending, views the batch input
+	std::string_view Line;
+	std::optional<ParseResult> Result;
+	std::exception_ptr Error;
+	// Unescaped tokens of the line viewed by Result, only allocated if the line contains quotes or escapes
+	std::unique_ptr<char[]> Storage;
+	// Tokens of the line viewed by the operands and value ranges of Result, only kept if it has any
+	std::vector<std::string_view> Tokens;
+
+	// Returns true if the line was parsed without errors
+	bool Ok() const {return Result.has_value();}
+	// Rethrows the error of the line, ValidatorException, MissingRequiredParameter, etc. Does nothing if the line was parsed
+	void Rethrow() const {if(Error) std::rethrow_exception(Error);}
+};
+
+/**
+ * @brief The per line outcomes of a batch, in input order
+ * The results view the batch input, which is kept alive by the BatchResult if it was read from a file.
+ */
+class BatchResult {
+	friend class BatchParser;
+
+	std::shared_ptr<const std::string> Buffer;
+	std::vector<BatchLineResult> Lines;
+
+public:
+	std::size_t size() const {return Lines.size();}
+	const BatchLineResult& operator[](std::size_t line) const {return Lines[line];}
+	std::vector<BatchLineResult>::const_iterator begin() const {return Lines.begin();}
+	std::vector<BatchLineResult>::const_iterator end() const {return Lines.end();}
+
+	// Counts the lines that failed to parse
+	std::size_t ErrorCount() const {
+		return static_cast<std::size_t>(std::count_if(Lines.begin(), Lines.end(), [](const BatchLineResult& Line){return !Line.Ok();}));
+	}
+};
+
+/**
+ * @brief Parses buffers of command lines, one per line, against an ArgumentParser on multiple threads
+ * Every line is a complete command line including the program name, it is split into tokens by Tokenize.
+ * Lines are distributed over the threads in chunks, threads that run out of lines steal half of the remaining lines of another thread.
+ * @note Validators and actions are called from the worker threads, actions that exit like those of -h and -V end the whole process.
+ */
+class BatchParser {
+	const ArgumentParser& Parser;
+	std::size_t ThreadCount;
+
+	// Lines handed out to a thread at once
+	static constexpr std::uint32_t ChunkSize = 64;
+
+	// Range of line indices still to be parsed by a thread, begin is stored in the low and end in the high 32 bits
+	struct alignas(64) WorkRange {
+		std::atomic<std::uint64_t> range{0};
+
+		static std::uint64_t Pack(std::uint32_t begin, std::uint32_t end) {return (std::uint64_t(end) << 32) | begin;}
+		static std::uint32_t Begin(std::uint64_t range) {return static_cast<std::uint32_t>(range);}
+		static std::uint32_t End(std::uint64_t range) {return static_cast<std::uint32_t>(range >> 32);}
+
+		// Takes up to ChunkSize lines from the front of the range, returns false if the range is empty
+		bool Take(std::uint32_t& begin, std::uint32_t& end){
+			std::uint64_t current = range.load(std::memory_order_acquire);
+			do{
+				if(Begin(current) >= End(current))
+					return false;
+				begin = Begin(current);
+				end = std::min(End(current), begin + ChunkSize);
+			} while(!range.compare_exchange_weak(current, Pack(end, End(current)), std::memory_order_acq_rel));
+			return true;
+		}
+
+		// Takes the back half of the range, returns false if there is nothing worth stealing
+		bool Steal(std::uint32_t& begin, std::uint32_t& end){
+			std::uint64_t current = range.load(std::memory_order_acquire);
+			do{
+				if(Begin(current) >= End(current))
+					return false;
+				end = End(current);
+				begin = Begin(current) + (End(current) - Begin(current)) / 2;
+			} while(!range.compare_exchange_weak(current, Pack(Begin(current), begin), std::memory_order_acq_rel));
+			return true;
+		}
+	};
+
+	void ParseLine(BatchLineResult& Line, std::vector<std::string_view>& Tokens) const {
+		try{
+			Tokenize(Line.Line, Tokens, Line.Storage);
+			Line.Result.emplace(Parser.Parse(Tokens));
+			if(Line.Result->HasRanges())
+				Line.Tokens.swap(Tokens);
+		}
+		catch(...){
+			Line.Error = std::current_exception();
+		}
+	}
+
+	// Parses every line of the result on ThreadCount threads
+	void ParseLines(std::vector<BatchLineResult>& Lines) const {
+		if(Lines.size() > std::numeric_limits<std::uint32_t>::max())
+			throw std::length_error("A batch can not contain more than 2^32 - 1 lines");
+		const std::uint32_t LineCount = static_cast<std::uint32_t>(Lines.size());
+		const std::uint32_t Workers = static_cast<std::uint32_t>(std::max<std::size_t>(1, std::min<std::size_t>(ThreadCount, (LineCount + ChunkSize - 1) / ChunkSize)));
+		// Give every thread an equal share to start with
+		std::vector<WorkRange> Ranges(Workers);
+		for(std::uint32_t t = 0; t < Workers; t++)
+			Ranges[t].range = WorkRange::Pack(static_cast<std::uint32_t>(std::uint64_t(LineCount) * t / Workers), 
+				static_cast<std::uint32_t>(std::uint64_t(LineCount) * (t + 1) / Workers));
+
+		auto Work = [&](std::uint32_t Self){
+			std::vector<std::string_view> Tokens;
+			std::uint32_t begin, end;
+			for(;;){
+				while(Ranges[Self].Take(begin, end))
+					for(std::uint32_t i = begin; i < end; i++)
+						ParseLine(Lines[i], Tokens);
+				// Out of work, steal from the other threads starting with the next one
+				bool Stolen = false;
+				for(std::uint32_t v = 1; v < Workers && !Stolen; v++)
+					Stolen = Ranges[(Self + v) % Workers].Steal(begin, end);
+				if(!Stolen)
+					return;
+				Ranges[Self].range.store(WorkRange::Pack(begin, end), std::memory_order_release);
+			}
+		};
+
+		std::vector<std::thread> Threads;
+		for(std::uint32_t t = 1; t < Workers; t++)
+			Threads.emplace_back(Work, t);
+		Work(0);
+		for(auto& Thread : Threads)
+			Thread.join();
+	}
+
+public:
+	/**
+	 * @brief Construct a new Batch Parser object
+	 * 
+	 * @param Parser The parser to parse every line against, it should outlive the batch results
+	 * @param ThreadCount The amount of threads to parse with, defaults to the amount of hardware threads
+	 */
+	BatchParser(const ArgumentParser& Parser, std::size_t ThreadCount = std::thread::hardware_concurrency()) 
+		: Parser(Parser), ThreadCount(ThreadCount ? ThreadCount : 1) {}
+
+	/**
+	 * @brief Parses a buffer of command lines
+	 * 
+	 * @param Buffer The command lines separated by \n or \r\n, the buffer should outlive the result
+	 * @return BatchResult The results and errors per line in input order
+	 * @throws length_error exception if the buffer contains more than 2^32 - 1 lines
+	 */
+	BatchResult ParseBuffer(std::string_view Buffer) const {
+		BatchResult Result;
+		std::size_t pos = 0;
+		while(pos < Buffer.size()){
+			std::size_t end = Buffer.find('\n', pos);
+			if(end == std::string_view::npos)
+				end = Buffer.size();
+			std::string_view Line = Buffer.substr(pos, end - pos);
+			if(!Line.empty() && Line.back() == '\r')
+				Line.remove_suffix(1);
+			Result.Lines.push_back(BatchLineResult{Line, std::nullopt, nullptr, nullptr, {}});
+			pos = end + 1;
+		}
+		ParseLines(Result.Lines);
+		return Result;
+	}
+
+	/**
+	 * @brief Reads a file of command lines and parses it, see ParseBuffer
+	 * 
+	 * @param Path Path to the file
+	 * @return BatchResult The results and errors per line in input order, owns the file contents
+	 * @throws runtime_error exception if the file can not be read
+	 */
+	BatchResult ParseFile(const std::string& Path) const {
+		std::ifstream File(Path, std::ios::binary);
+		if(!File)
+			throw std::runtime_error("Could not open batch file " + Path);
+		auto Buffer = std::make_shared<std::string>((std::istreambuf_iterator<char>(File)), std::istreambuf_iterator<char>());
+		BatchResult Result = ParseBuffer(*Buffer);
+		Result.Buffer = std::move(Buffer);
+		return Result;
+	}
+};
+
+//?==== Incremental parsing ====?//
+
+/**
+ * @brief Parses arguments that arrive in pieces, like over a pipe or socket, without the whole command line ever existing
+ * Tokens are pushed one at a time with Push or as raw bytes with Feed, which splits them like Tokenize while keeping its state across chunks.
+ * There is no program name, the first token is already an argument or operand. An argument is parsed as soon as its last parameter arrives: 
+ * its validator and action run and the OnArgument hook is called. An argument with fewer parameters is complete at the next argument or at Finish.
+ * Finish adds the values of config files and the environment in priority order, checks the required arguments and constraints and returns the result.
+ * 
+ * Only the parameters of the first occurrence of every argument are kept, values of later occurrences, of variadic arguments and 
+ * operands are passed to the OnValue and OnOperand hooks instead of being stored, so memory use does not grow with the stream.
+ * Response files are not expanded and Values() and Operands() of the result are empty.
+ * @note Unlike ParseArguments, validators and actions run before the required arguments are checked.
+ * After an exception the stream is in an undefined state, call Reset before pushing the next stream.
+ * @tparam Instrumentation The instrumentation policy, see ParseInstrumentation
+ */
+template<typename Instrumentation = NoInstrumentation>
+class IncrementalParser {
+	const ArgumentParser& Parser;
+	Instrumentation& Instr;
+
+	// Shell quoting state of Feed between chunks
+	enum class LexState {Space, Word, Escape, Single, Double, DoubleEscape};
+	LexState Lex = LexState::Space;
+	std::string Token; // the token Feed is reading
+
+	// The argument receiving parameters, for a compound argument the argument of CompoundPos
+	Argument* Current = nullptr;
+	std::string Compound;
+	std::size_t CompoundPos = 0;
+	std::size_t Taken = 0; // parameters passed to Current
+	std::vector<std::string> Pending; // the parameters within the parameter count of Current, reused between arguments
+	std::vector<std::string_view> PendingViews;
+
+	// Values of the first occurrence of every argument, indexed by the position it was added at
+	std::vector<ParsedValues> Kept;
+	TokenStorage Storage; // parameters viewed by Kept
+	ArgumentBits Present; // arguments passed so far
+
+	static NoInstrumentation& DefaultInstrumentation(){
+		static NoInstrumentation Instr;
+		return Instr;
+	}
+
+	// Starts receiving the parameters of an argument
+	void Start(Argument* Argpos){
+		Current = Argpos;
+		Taken = 0;
+		Present.Set(Argpos->_index);
+	}
+
+	// Starts the argument of the next character of a compound argument, returns false at the end
+	bool NextCompound(){
+		if(++CompoundPos >= Compound.size()){
+			Compound.clear();
+			return false;
+		}
+		Argument* Argpos = Parser.ShortCalleeIndex[static_cast<unsigned char>(Compound[CompoundPos])];
+		Instr.LookedUp(Compound, Argpos);
+		if(!Argpos)
+			Parser.ThrowUnknown("-" + std::string(1, Compound[CompoundPos]), "-" + Compound);
+		Start(Argpos);
+		return true;
+	}
+
+	// Parses the argument being received, the values of its first occurrence are kept
+	void Complete(){
+		Argument* Argpos = Current;
+		Current = nullptr;
+		const std::size_t Count = std::min(Taken, Argpos->ParamCount());
+		ParsedValues& Slot = Kept[Argpos->_index];
+		PendingViews.assign(Pending.begin(), Pending.begin() + Count);
+		if(!Slot.is_used){
+			// keep copies, Pending is reused by the next argument
+			for(std::string_view& View : PendingViews){
+				Storage.Tokens.emplace_back(new char[View.size() ? View.size() : 1]);
+				std::memcpy(Storage.Tokens.back().get(), View.data(), View.size());
+				View = std::string_view(Storage.Tokens.back().get(), View.size());
+			}
+			Argpos->_ParseArg(PendingViews.data(), Count, Slot, Instr);
+			if(OnArgument)
+				OnArgument(*Argpos, ParsedArgument(*Argpos, Slot, Empty()));
+		}
+		else{
+			ParsedValues Values;
+			Argpos->_ParseArg(PendingViews.data(), Count, Values, Instr);
+			if(OnArgument)
+				OnArgument(*Argpos, ParsedArgument(*Argpos, Values, Empty()));
+		}
 	}
 
-	/**
-	 * @brief Sets the priority of the argument
-	 * Arguments can be sorted by priority, A higher priority means it will be handled before lower priority arguments.
-	 * Same level priority arguments are sorted based on input
-	 * @param priority The priority of the argument
-	 * @return Argument& The argument reference
-	 */
-	Argument& priority(std::size_t priority){
-		_priority = priority;
-		return *this;
+	static const TokenRange& Empty(){
+		static const TokenRange Range;
+		return Range;
+	}
+
+	// Passes a parameter token to the argument being received, returns false if the argument does not take it
+	bool Take(std::string_view Token){
+		const bool Compounded = !Compound.empty();
+		if(!Parser.TakesParameter(Current->_index, Token))
+			return false;
+		if(!Current->Has(ArgumentFlag::Variadic) && Taken >= Current->ParamCount())
+			return false;
+		if(ArgumentParser::isArgument(Token)){
+			if(Compounded && !Current->Has(ArgumentFlag::Variadic))
+				throw std::out_of_range("Not enough parameters for compound argument " + Compound + " use -h for help");
+			return false;
+		}
+		Instr.TokenClassified(Token, false);
+		if(Taken < Current->ParamCount()){
+			if(Pending.size() <= Taken)
+				Pending.emplace_back();
+			Pending[Taken].assign(Token.data(), Token.size());
+		}
+		Taken++;
+		if(Current->Has(ArgumentFlag::Variadic) || Current->Has(ArgumentFlag::Repeatable))
+			if(OnValue)
+				OnValue(*Current, Token);
+		return true;
 	}
 
+	// Checks if the argument being received has all its parameters
+	bool Filled() const {return !Current->Has(ArgumentFlag::Variadic) && Taken >= Current->ParamCount();}
+
+public:
+	// Called with every argument once it is parsed, with the values of that occurrence
+	std::function<void(const Argument& Arg, const ParsedArgument& Values)> OnArgument;
+	// Called with every value of a variadic or repeatable argument
+	std::function<void(const Argument& Arg, std::string_view Value)> OnValue;
+	// Called with every operand, the tokens that are not an argument or one of its parameters
+	std::function<void(std::string_view Operand)> OnOperand;
+
 	/**
-	 * @brief Gets a string value reference of the parameter based on idx
+	 * @brief Construct a new Incremental Parser object
 	 * 
-	 * @param idx The position of the parameter in the list
-	 * @return std::string& A reference to the parameter string value
+	 * @param Parser The parser whose arguments are parsed, it should outlive the incremental parser and the results
+	 * @param Instr The instrumentation policy, see ParseInstrumentation
 	 */
-	std::string& operator[](std::size_t idx) {return _ParamValues[idx];}
+	IncrementalParser(const ArgumentParser& Parser, Instrumentation& Instr) : Parser(Parser), Instr(Instr) {Reset();}
+
 	/**
-	 * @brief Gets a string value of the parameter based on idx 
+	 * @brief Construct a new Incremental Parser object without instrumentation
 	 * 
-	 * @param idx The position of the parameter in the list
-	 * @return std::string The string value of the parameter
+	 * @param Parser The parser whose arguments are parsed, it should outlive the incremental parser and the results
 	 */
-	std::string  operator[](std::size_t idx) const {return _ParamValues[idx];}
+	template<typename I = Instrumentation, typename = typename std::enable_if<std::is_same<I, NoInstrumentation>::value>::type>
+	explicit IncrementalParser(const ArgumentParser& Parser) : IncrementalParser(Parser, DefaultInstrumentation()) {}
 
 	/**
-	 * @brief Parses the parameter value to the given type based on T
+	 * @brief Pushes the next token of the stream
 	 * 
-	 * @tparam T The type to parse the string to
-	 * @param idx the position of the parameter to parse
-	 * @return T The parsed value
-	 * @throws out_of_range exception if idx is bigger or equal to the size of the parameter list
-	 * @throws out_of_range exception if stored parameter value is an empty string.
+	 * @param Token A whole token, it is copied if needed
+	 * @throws invalid_argument exception if the token is an unknown argument
+	 * @throws out_of_range exception if an argument of a compound argument does not get enough parameters
+	 * @throws ValidatorException if the validator of a completed argument fails
 	 */
-	template<typename T> T Parse(std::size_t idx) const {
-		if(idx >= _ParamValues.size())
-			throw std::out_of_range("Argument " + Callees[0] + "'s parameter "  + std::to_string(idx) + " is out of range!");
-		if(_ParamValues[idx].empty())
-			throw std::out_of_range("Argument " + Callees[0] + "'s parameter "  + std::to_string(idx) + " was not set!");
-		return ToType<T>(_ParamValues[idx]);}
+	void Push(std::string_view Token){
+		while(Current){
+			if(Take(Token)){
+				if(Filled()){
+					Complete();
+					if(!Compound.empty())
+						NextCompound();
+				}
+				return;
+			}
+			Complete();
+			if(Compound.empty() || !NextCompound())
+				break;
+		}
+		const bool TokenIsArgument = ArgumentParser::isArgument(Token);
+		Instr.TokenClassified(Token, TokenIsArgument);
+		if(!TokenIsArgument){
+			if(OnOperand)
+				OnOperand(Token);
+			return;
+		}
+		if(Token[1] != '-' && Token.size() > 2){
+			// a compound argument, every argument takes its parameters in turn
+			Compound.assign(Token.data(), Token.size());
+			CompoundPos = 0;
+			NextCompound();
+			return;
+		}
+		Argument* Argpos;
+		bool Ambiguous = false;
+		{
+			typename Instrumentation::Timer LookupTimer(Instr, ParsePhase::Lookup);
+			Argpos = Parser.LookupCallee(Token, Ambiguous);
+		}
+		Instr.LookedUp(Token, Argpos);
+		if(Ambiguous)
+			Parser.ThrowAmbiguous(Token);
+		if(!Argpos)
+			Parser.ThrowUnknown(Token, Token);
+		Start(Argpos);
+	}
 
 	/**
-	 * @brief Boolean check for if the argument was used in the function call.
-	 * 
-	 * @return true The argument was used
-	 * @return false The argument was not used
+	 * @brief Feeds the next chunk of the stream, tokens are split following POSIX shell quoting rules like Tokenize does
+	 * Chunks can be of any size, a token or quote may continue in the next chunk.
+	 * @param Chunk The next bytes of the stream
+	 * @throws see Push
 	 */
-	bool IsUsed() const {
-		return is_used;
+	void Feed(std::string_view Chunk){
+		for(const char c : Chunk){
+			switch(Lex){
+			case LexState::Space:
+				if(IsShellWhitespace(c))
+					break;
+				Token.clear();
+				Lex = LexState::Word;
+				[[fallthrough]];
+			case LexState::Word:
+				if(IsShellWhitespace(c)){
+					Lex = LexState::Space;
+					Push(Token);
+				}
+				else if(c == '\\')
+					Lex = LexState::Escape;
+				else if(c == '\'')
+					Lex = LexState::Single;
+				else if(c == '"')
+					Lex = LexState::Double;
+				else
+					Token.push_back(c);
+				break;
+			case LexState::Escape:
+				if(c != '\n') // backslash newline continues the line
+					Token.push_back(c);
+				Lex = LexState::Word;
+				break;
+			case LexState::Single:
+				if(c == '\'')
+					Lex = LexState::Word;
+				else
+					Token.push_back(c);
+				break;
+			case LexState::Double:
+				if(c == '"')
+					Lex = LexState::Word;
+				else if(c == '\\')
+					Lex = LexState::DoubleEscape;
+				else
+					Token.push_back(c);
+				break;
+			case LexState::DoubleEscape:
+				if(c == '$' || c == '`' || c == '"' || c == '\\')
+					Token.push_back(c);
+				else if(c != '\n'){ // other characters keep their backslash
+					Token.push_back('\\');
+					Token.push_back(c);
+				}
+				Lex = LexState::Double;
+				break;
+			}
+		}
 	}
 
 	/**
-	 * @brief Print Argument to an ostream
-	 * 
-	 * @param os output stream object
-	 * @param ArgBase The argument to print to the output stream object
-	 * @return std::ostream& The output stream reference
+	 * @brief Ends the stream and returns the values of all arguments
+	 * Completes the last argument, adds the values of config files and the environment for arguments that were not passed 
+	 * in priority order and checks the required arguments. The parser is reset for the next stream.
+	 * @return ParseResult The values of the first occurrence of every passed argument
+	 * @throws invalid_argument exception if the stream ends within quotes or an escape
+	 * @throws MissingRequiredParameter if any required arguments are missing
+	 * @throws ConstraintViolation if the passed arguments violate a constraint
 	 */
-	friend std::ostream& operator<<(std::ostream& os, const Argument& ArgBase){
-		std::string calleeFormatted = ArgBase.GetCalleeFormatted();
-		os << "\t" << std::left << std::setw(CalleeLengthBeforeDescription) << calleeFormatted;
-		if(calleeFormatted.length() >= CalleeLengthBeforeDescription)
-			os << std::endl << "\t" << std::string(CalleeLengthBeforeDescription, ' ');
-		std::string tempHelpString = ArgBase.helpString;
-		for(std::size_t pos = 0; (pos = tempHelpString.find("\n", pos)) != std::string::npos; pos+=CalleeLengthBeforeDescription+1)
-			tempHelpString.replace(pos, 1, "\n\t" + std::string(CalleeLengthBeforeDescription, ' '));
-		os << tempHelpString << std::endl;	
-		os << "\t" << std::right << std::setw(CalleeLengthBeforeDescription + 7) << "Usage: " << ArgBase.Callees[0];
-		std::stringstream ss;
-		ArgBase.FormatParameters(ss);
-		os << " " << ss.str() << std::endl;
-		return os;
+	ParseResult Finish(){
+		switch(Lex){
+		case LexState::Space:
+			break;
+		case LexState::Word:
+			Lex = LexState::Space;
+			Push(Token);
+			break;
+		case LexState::Escape:
+			throw std::invalid_argument("Command line ends within an escape");
+		case LexState::Single:
+			throw std::invalid_argument("Command line ends within single quotes");
+		case LexState::Double:
+		case LexState::DoubleEscape:
+			throw std::invalid_argument("Command line ends within double quotes");
+		}
+		while(Current){
+			Complete();
+			if(Compound.empty() || !NextCompound())
+				break;
+		}
+		// Add the values of configuration sources for arguments that were not passed, the highest priority first
+		std::vector<const ArgumentParser::SourceValues*> Sourced;
+		for(const auto* Layer : {&Parser.EnvironmentValues, &Parser.ConfigValues})
+			for(auto it = Layer->rbegin(); it != Layer->rend(); ++it)
+				if(!Kept[it->Arg->_index].is_used && std::none_of(Sourced.begin(), Sourced.end(), [&](const auto* Values){return Values->Arg == it->Arg;}))
+					Sourced.push_back(&*it);
+		std::stable_sort(Sourced.begin(), Sourced.end(), [](const auto* A, const auto* B){return A->Arg->Priority() > B->Arg->Priority();});
+		for(const auto* Values : Sourced){
+			Present.Set(Values->Arg->_index);
+			Values->Arg->_ParseArg(Parser.Sources->Parameters.data() + Values->Span.first, Values->Span.count, Kept[Values->Arg->_index], Instr);
+		}
+		bool Valid;
+		{
+			typename Instrumentation::Timer RequiredTimer(Instr, ParsePhase::RequiredCheck);
+			Valid = Parser.Satisfied(Present);
+		}
+		if(!Valid){
+			const ArgumentBits Passed = Present;
+			Reset();
+			Parser.ThrowViolation(Passed);
+		}
+		ParseResult Result(Parser);
+		for(std::size_t i = 0; i < Kept.size(); i++)
+			if(Kept[i].is_used)
+				Result.Add(i) = std::move(Kept[i]);
+		Result.Storage = std::move(Storage);
+		if(!Sourced.empty())
+			Result.Sources = Parser.Sources;
+		Reset();
+		return Result;
 	}
-	
+
 	/**
-	 * @brief Checks if the given string callee matches with any of this argument
-	 * 
-	 * @param callee The callee to check
-	 * @return true This argument contains this callee
-	 * @return false This argument does not contain this callee
+	 * @brief Discards the stream read so far and starts a new one
 	 */
-	bool operator==(const std::string& callee) const {
-		return std::find(Callees.begin(), Callees.end(), callee) != Callees.end();
+	void Reset(){
+		Lex = LexState::Space;
+		Current = nullptr;
+		Compound.clear();
+		Kept.assign(Parser.ArgumentList.size(), ParsedValues());
+		Storage.clear();
+		Present = ArgumentBits(Parser.ArgumentList.size());
 	}
 };
 
-class ArgumentParser {
-	std::map<std::string, Argument> Arguments;
-	std::string ProgramName;
-	std::size_t Version[2];
+//?==== Compile time schema ====?//
 
-	// Splits a string by a delimiter
-	std::vector<std::string> SplitByDelimiter(std::string source, std::string delimiter){
-		std::vector<std::string> split;
-		size_t pos = 0;
-		while ((pos = source.find(delimiter)) != std::string::npos) {
-			split.push_back(source.substr(0, pos));
-			source.erase(0, pos + delimiter.length());
-		}
-		split.push_back(source);
+template<const auto&... Options>
+class StaticParser;
 
-		return split;
-	}
+// checks if a type T can be a parameter of a StaticOption, these are converted by a registered Converter or FastConvert without allocating
+template<typename T>
+using supports_static_conversion = std::integral_constant<bool, (has_converter<T>::value || supports_fast_conversion<T>::value) && !std::is_same<T, std::string>::value>;
 
-	// generates default usage string based on required arguments and programname
-	std::string defaultUsage(){
-		std::stringstream ss;
-		ss << "./" << ProgramName << " ";
-		for(const auto& A : Arguments){
-			if(A.second.required){
-				ss << A.second.Callees[0] << " ";
-				A.second.FormatParameters(ss);
-				ss << " ";
-			}
-		}
-		return ss.str();
-	}
+// Checks the callee format of addArgument at compile time, empty callees are allowed
+constexpr bool IsValidStaticCallee(std::string_view Callee){
+	return Callee.empty() 
+		|| (Callee.size() == 2 && Callee[0] == '-' && Callee[1] != '-' && !(Callee[1] >= '0' && Callee[1] <= '9')) 
+		|| (Callee.size() > 2 && Callee[0] == '-' && Callee[1] == '-' && !(Callee[2] >= '0' && Callee[2] <= '9'));
+}
+
+/**
+ * @brief An option of a compile time schema, declared constexpr and passed to a StaticParser
+ * Parameter types are limited to integers, floating point numbers, characters, bool, std::string_view and types with a registered Converter, 
+ * which are converted without allocating. std::string_view parameters view the parsed tokens. An option without parameter types is a flag.
+ * @code
+ * constexpr auto Port = ArgPar::StaticOption<int>("-p", "--port").DefaultValue(8080);
+ * @endcode
+ * @tparam ParamTypes The types of the parameters
+ */
+template<typename ...ParamTypes>
+class StaticOption {
+	static_assert(std::conjunction<supports_static_conversion<ParamTypes>...>::value, 
+		"StaticOption parameters should be integers, floating point numbers, characters, bool, std::string_view or have a registered ArgPar::Converter");
+
+	template<const auto&...> friend class StaticParser;
+
+public:
+	using Values = std::tuple<ParamTypes...>;
+	static constexpr std::size_t ParameterCount = sizeof...(ParamTypes);
+
+private:
+	std::string_view Callee1;
+	std::string_view Callee2;
+	Values Defaults;
+	bool required;
+	bool has_defaultValues;
+
+	constexpr StaticOption(std::string_view Callee1, std::string_view Callee2, Values Defaults, bool required, bool has_defaultValues)
+		: Callee1(Callee1), Callee2(Callee2), Defaults(Defaults), required(required), has_defaultValues(has_defaultValues) {}
 
 public:
 	/**
-	 * @brief Adds an argument to the list of arguments
-	 * @note Callee1 and Callee2 should not be the same length! If two callees are used one should be a single character and the other a multicharacter. Order does not matter.
-	 * @tparam ParamTypes The Argument data types
+	 * @brief Construct a new option
+	 * 
 	 * @param Callee1 First Possible Argument Callee, Single character prefix with -, multi character prefix with --
 	 * @param Callee2 Second Possible Argument Callee, Single character prefix with -, multi character prefix with --
-	 * @return Argument& The argument reference
-	 * @throws runtime_error exception if std::map<std::string, Argument>.insert() failed
 	 */
-	template<typename ...ParamTypes>
-	Argument& addArgument(std::string Callee1, std::string Callee2 = ""){
-		static_assert(sizeof...(ParamTypes) > 0, "addArgument Requires atleast 1 template parameter");
-		auto CalleeFormatValidator = [](const std::string& Callee){
-			return (Callee.size() == 0) || (Callee.size() == 2 && Callee[0] == '-' && Callee[1] != '-' && !std::isdigit(Callee[1])) || (Callee.size() > 2 && Callee[0] == '-' && Callee[1] == '-' && !isdigit(Callee[3]));
-		};
-		if(!CalleeFormatValidator(Callee1) || !CalleeFormatValidator(Callee2) || (Callee1.size() == Callee2.size()))
-			throw std::invalid_argument("Argument callee does not follow format: Single character arguments should start with prefix -, multi character arguments should start with prefix --");		
-		// If a second callee is given sort based on length
-		if(!Callee2.empty())
-			if(Callee2.size() < Callee1.size()) // make sure Callee1 is the shortest
-				std::swap(Callee1, Callee2);
-
-		auto insert_pair_ret = Arguments.insert({Callee1, Argument{sizeof...(ParamTypes), Callee1, Callee2}});
-		if(!insert_pair_ret.second)
-			throw std::runtime_error("Insertion of argument failed, maybe the Callee is already used.");
-		insert_pair_ret.first->second.InitParamNamesDefault<0, ParamTypes...>();
-		return insert_pair_ret.first->second;
-	}
+	constexpr StaticOption(std::string_view Callee1, std::string_view Callee2 = std::string_view())
+		: StaticOption(Callee1, Callee2, Values(), false, false) {}
 
 	/**
-	 * @brief Adds a flag to the list of arguments
+	 * @brief Returns the option with default values, used for parameters that are not passed
 	 * 
-	 * @param Callee1 First Possible Argument Callee, Single character prefix with -, multi character prefix with --
-	 * @param Callee2 Second Possible Argument Callee, Single character prefix with -, multi character prefix with --
-	 * @return Argument& The argument reference
+	 * @param defaultValues Default value per parameter
+	 * @return StaticOption The option with default values
 	 */
-	Argument& addFlag(std::string Callee1, std::string Callee2 = ""){
-		Argument* _flag = &addArgument<bool>(Callee1, Callee2)
-			.ImplicitValue(true)
-			.DefaultValue(false);
-		_flag->is_flag = true;
-		return *_flag;
+	constexpr StaticOption DefaultValue(ParamTypes... defaultValues) const {
+		return StaticOption(Callee1, Callee2, Values(defaultValues...), required, true);
 	}
 
 	/**
-	 * @brief Construct a new Argument Parser object
+	 * @brief Returns the option marked as required, parsing throws MissingRequiredParameter if it is not passed
 	 * 
-	 * @param ProgramName The programname 
-	 * @param Major Major version
-	 * @param Minor Minor version
+	 * @return StaticOption The required option
 	 */
-	ArgumentParser(std::string ProgramName, std::size_t Major, std::size_t Minor) : ProgramName(ProgramName){
-		Version[0] = Major;
-		Version[1] = Minor;
+	constexpr StaticOption Required() const {
+		return StaticOption(Callee1, Callee2, Defaults, true, has_defaultValues);
+	}
+};
 
-		addFlag("-V", "--Version")
-			.Action([&]
-				(const std::vector<std::string>&){
-				std::cout << "Software version: " << ArgumentParser::Version[0] << "." 
-					<< ArgumentParser::Version[1] << std::endl;
-				exit(0);
-				}, false)
-			.Help("Displays the software version")
-			.ParseAlways()
-			.priority(std::numeric_limits<std::size_t>::max());
-		addFlag("-h", "--help")
-			.Action([&]
-				(const std::vector<std::string>&){
-					std::cout << "Default Usage: " << defaultUsage() << std::endl;
-					for(auto const& pair: Arguments)
-						std::cout << pair.second << std::endl;
-					exit(0);
-				}, false)
-			.Help("Displays this message")
-			.ParseAlways()
-			.priority(std::numeric_limits<std::size_t>::max());
+// A flag of a compile time schema, see StaticParser::Result::IsSet
+using StaticFlag = StaticOption<>;
+
+/**
+ * @brief A parser for a schema of StaticOptions fixed at compile time
+ * The callee table is built and checked at compile time, parsing a command line does not allocate unless it fails or has operands.
+ * Options are passed by reference, so they should be constexpr variables at namespace scope or static:
+ * @code
+ * constexpr auto Port = ArgPar::StaticOption<int>("-p", "--port").DefaultValue(8080);
+ * constexpr auto Verbose = ArgPar::StaticFlag("-v", "--verbose");
+ * using Parser = ArgPar::StaticParser<Port, Verbose>;
+ * 
+ * auto Result = Parser::Parse(argc, argv);
+ * int port = Result.Get<Port>();
+ * bool verbose = Result.IsSet<Verbose>();
+ * @endcode
+ * Tokens are split into arguments, parameters and operands like ArgumentParser::ParseArguments does, compound arguments included. 
+ * A flag only takes a following 0, 1, true or false, tokens beyond the parameters of an option are operands, see Result::Operands. 
+ * Operands are the only part of a successful parse that allocates, one run per stretch of consecutive operands. 
+ * Priorities, validators and actions are not supported, of a repeated option the last values are kept.
+ */
+template<const auto&... Options>
+class StaticParser {
+	static constexpr std::size_t OptionCount = sizeof...(Options);
+	static_assert(OptionCount > 0, "StaticParser requires at least 1 option");
+
+	struct CalleeEntry {
+		std::string_view Callee;
+		std::size_t Index;
+	};
+
+	static constexpr std::size_t CalleeCount = ((Options.Callee2.empty() ? 1 : 2) + ...);
+
+	// Every callee with the index of its option, sorted by callee
+	static constexpr std::array<CalleeEntry, CalleeCount> BuildCalleeTable(){
+		constexpr std::string_view Callees1[] = {Options.Callee1...};
+		constexpr std::string_view Callees2[] = {Options.Callee2...};
+		std::array<CalleeEntry, CalleeCount> Table{};
+		std::size_t n = 0;
+		for(std::size_t i = 0; i < OptionCount; i++){
+			Table[n++] = CalleeEntry{Callees1[i], i};
+			if(!Callees2[i].empty())
+				Table[n++] = CalleeEntry{Callees2[i], i};
+		}
+		// insertion sort, the table is small and std::sort is not constexpr
+		for(std::size_t i = 1; i < CalleeCount; i++)
+			for(std::size_t j = i; j > 0 && Table[j].Callee < Table[j - 1].Callee; j--){
+				const CalleeEntry Swap = Table[j];
+				Table[j] = Table[j - 1];
+				Table[j - 1] = Swap;
+			}
+		return Table;
+	}
+	static constexpr std::array<CalleeEntry, CalleeCount> CalleeTable = BuildCalleeTable();
+
+	// Option index of every single character callee, OptionCount if there is none
+	static constexpr std::array<std::size_t, 256> BuildShortTable(){
+		std::array<std::size_t, 256> Table{};
+		for(std::size_t& Index : Table)
+			Index = OptionCount;
+		for(const CalleeEntry& Entry : CalleeTable)
+			if(Entry.Callee.size() == 2)
+				Table[static_cast<unsigned char>(Entry.Callee[1])] = Entry.Index;
+		return Table;
+	}
+	static constexpr std::array<std::size_t, 256> ShortTable = BuildShortTable();
+
+	static constexpr bool CalleesAreValid(){
+		bool Valid = true;
+		for(const CalleeEntry& Entry : CalleeTable)
+			Valid = Valid && !Entry.Callee.empty() && IsValidStaticCallee(Entry.Callee);
+		return Valid;
+	}
+	static constexpr bool CalleesAreUnique(){
+		for(std::size_t i = 1; i < CalleeCount; i++)
+			if(CalleeTable[i].Callee == CalleeTable[i - 1].Callee)
+				return false;
+		return true;
+	}
+	static_assert(CalleesAreValid(), "Option callee does not follow format: Single character arguments should start with prefix -, multi character arguments should start with prefix --");
+	static_assert(CalleesAreUnique(), "A callee is used by more than one option");
+
+	// Gets the position of an option in the schema, OptionCount if it is not part of it
+	template<const auto& Option>
+	static constexpr std::size_t IndexOf(){
+		constexpr const void* Addresses[] = {static_cast<const void*>(&Options)...};
+		for(std::size_t i = 0; i < OptionCount; i++)
+			if(Addresses[i] == static_cast<const void*>(&Option))
+				return i;
+		return OptionCount;
+	}
+
+	// Looks up the option index of a callee, OptionCount if it is unknown
+	static std::size_t FindCallee(std::string_view Callee) noexcept {
+		if(Callee.size() == 2 && Callee[0] == '-')
+			return ShortTable[static_cast<unsigned char>(Callee[1])];
+		auto it = std::lower_bound(CalleeTable.begin(), CalleeTable.end(), Callee, [](const CalleeEntry& Entry, std::string_view Callee){return Entry.Callee < Callee;});
+		return it != CalleeTable.end() && it->Callee == Callee ? it->Index : OptionCount;
+	}
+
+	// Throws for an unknown argument with the closest callees as suggestions, see ArgumentParser::ThrowUnknown
+	[[noreturn]] static void ThrowUnknown(const std::string& Token, std::string_view Query){
+		SuggestionCollector Collector(Query);
+		for(const CalleeEntry& Entry : CalleeTable)
+			Collector.Offer(Entry.Callee, Entry.Index);
+		std::vector<std::string> Suggestions = Collector.Take();
+		std::string Message = "Unkown console argument: " + Token;
+		for(std::size_t i = 0; i < Suggestions.size(); i++)
+			Message += (i ? ", " : ", did you mean ") + Suggestions[i] + (i + 1 == Suggestions.size() ? "?" : "");
+		throw UnknownArgument(Message + " use -h for help", Token, std::move(Suggestions));
 	}
 
+	template<std::size_t I>
+	using OptionAt = std::decay_t<decltype(std::get<I>(std::forward_as_tuple(Options...)))>;
+
+public:
 	/**
-	 * @brief Parses the command line arguments
-	 * 
-	 * @param argc The given argument count
-	 * @param argv The list of argument values
-	 * 
-	 * @throws invalid_argument exception if a passed argument is unknown
-	 * @throws out_of_range exception if a compound argument list does not contain enough parameters
-	 * @throws MissingRequiredParameter if any required parameters are missing
+	 * @brief The typed values of all options of a parse, initialized with the default values
 	 */
-	void ParseArguments(const int argc, const char** argv){
-		std::size_t ReqArgumentCount = 0;
-		for(auto& pair : Arguments)
-			if(pair.second.required)
-				ReqArgumentCount++;
-		
-		std::map<
-			std::pair<std::size_t, std::size_t>, 
-			std::pair<Argument*, std::vector<std::string>>, 
-			std::greater<std::pair<std::size_t, std::size_t>>> ArgumentData;
-		std::map<
-			std::pair<std::size_t, std::size_t>, 
-			std::pair<Argument*, std::vector<std::string>>, 
-			std::greater<std::pair<std::size_t, std::size_t>>> ParseAlwaysArguments;
+	class Result {
+		friend class StaticParser;
 
-		// checks if a string is an argument
-		auto isArgument = [](std::string Callee) -> bool{
-			return (Callee.size() == 2 && Callee[0] == '-' && Callee[1] != '-' && !std::isdigit(Callee[1])) 
-				|| (Callee.size() > 2 && Callee[0] == '-' && !isdigit(Callee[1]));
-		};
+		std::tuple<typename std::decay_t<decltype(Options)>::Values...> Values{Options.Defaults...};
+		std::array<bool, OptionCount> Used{};
+		// the values of passed flags, true unless followed by 0 or false
+		std::array<bool, OptionCount> Flags{};
+		TokenRange _Operands;
 
-		std::size_t w = 0;
-		for(std::size_t i = 1; i < (std::size_t)argc; i++){
-			// check if string starts with -
-			if(isArgument(argv[i])){
-				// single dash with multiple arguments is a compound argument. Disect
-				if(argv[i][1] != '-' && std::strlen(argv[i]) > 2){
-					std::size_t k = 0; // keep track of every parameters for each compound argument;
-					for(std::size_t j = 1; j < std::strlen(argv[i]); j++){ // j is argv[i] itterator start at 1 to skip -
-						auto Argpos = Arguments.find("-" + std::string(1, argv[i][j]));
-						if(Argpos == Arguments.end())
-							throw std::invalid_argument("Unkown console argument: -" + std::string(1, argv[i][j]) + " use -h for help");
-						auto insertRef = ArgumentData.insert({{Argpos->second._priority, w++}, std::make_pair(&(Argpos->second), std::vector<std::string>(0))}); // add - argument for later parsing.
-						if(!insertRef.second)
-							throw std::runtime_error("Insertion of argument failed, maybe the key is already used.");
-						std::size_t l = 0;
-						for(;l < Argpos->second._paramcount && i + 1 + k + l < (std::size_t)argc; l++){
-							if(isArgument(argv[i+1+k+l]))
-								throw std::out_of_range("Not enough parameters for compound argument " + std::string(argv[i]) + " use -h for help");
-							insertRef.first->second.second.push_back(argv[i+1+k+l]);
-						}
-						// add to parseAlways if needed
-						if(Argpos->second.parseAlways)
-							ParseAlwaysArguments.insert(*insertRef.first);
-						k+=l;
-						if(Argpos->second.required)
-							ReqArgumentCount--;
-					}
-					i += k; // k is the amount of parameters parsed
-				}
-				else{
-					// Find argument
-					auto Argpos = std::find_if(Arguments.begin(), Arguments.end(), [&](std::pair<std::string, ArgPar::Argument> A){
-						return A.second == argv[i];
-					});
-					if(Argpos == Arguments.end())
-						throw std::invalid_argument("Unkown console argument: " + std::string(argv[i]) + " use -h for help");
-					// Remove from required Argument count
-					if(Argpos->second.required)
-						ReqArgumentCount--;
-					auto insertRef = ArgumentData.insert({{Argpos->second._priority, w++}, std::make_pair(&(Argpos->second), std::vector<std::string>(0))});
-					if(!insertRef.second)
-						throw std::runtime_error("Insertion of argument failed, maybe the key is already used.");
-					std::size_t j = 0;
-					for(; i+j+1 < (std::size_t)argc; j++){
-						// check if parameter is actually an argument
-						if(isArgument(argv[i+j+1]))
-							break;
-						insertRef.first->second.second.push_back(argv[i+j+1]); // add parameters
-					}
-					// add to parseAlways if needed
-					if(Argpos->second.parseAlways)
-						ParseAlwaysArguments.insert(*insertRef.first);
+		template<typename T>
+		static void Convert(std::string_view Parameter, T& Value){
+			if(Parameter.empty() || !ConvertParameter(Parameter, Value))
+				throw std::invalid_argument("Conversion from \"" + std::string(Parameter) + "\" to " + cached_type_name<T>() + " failed");
+		}
 
-					i += j;
-				}
+		// Stores the parameters of the option at index I, missing parameters keep their default values
+		template<std::size_t I>
+		void Set(const std::string_view* Parameters, std::size_t ParameterCount){
+			constexpr auto& Option = std::get<I>(std::forward_as_tuple(Options...));
+			constexpr std::size_t Count = OptionAt<I>::ParameterCount;
+			if(ParameterCount < Count){
+				if(!Option.has_defaultValues)
+					throw std::out_of_range("Not enough parameters for argument: " + std::string(Option.Callee1));
+				std::get<I>(Values) = Option.Defaults;
 			}
+			AssignPassed<I>(Parameters, std::min(ParameterCount, Count), std::make_index_sequence<Count>());
+			Used[I] = true;
 		}
-		// Check all required arguments were passed
-		if(ReqArgumentCount != 0){
-			for(auto p : ParseAlwaysArguments)
-				p.second.first->_ParseArg(p.second.second); // Parse the "parse always" argument regardless of required arguments.
-			std::vector<std::string> missingArguments;
-			for(auto p : Arguments){
-				if(p.second.required){
-					// find the required argument in the passed arguments
-					auto it = std::find_if(ArgumentData.begin(), ArgumentData.end(), [&](auto A){
-						return &p.second == A.second.first; // We can use pointers as both arguments are from the same list
-					});
-					// if it was not found add it
-					if(it == ArgumentData.end())
-						missingArguments.push_back(p.second.Callees[0]);
-				}
-			}
-			throw MissingRequiredParameter("Not all required arguments were passed. Default usage: " + defaultUsage(), missingArguments);		
+
+		// Converts the first PassedCount parameters into the values of the option at index I
+		template<std::size_t I, std::size_t... ParamIdx>
+		void AssignPassed([[maybe_unused]] const std::string_view* Parameters, [[maybe_unused]] std::size_t PassedCount, std::index_sequence<ParamIdx...>){
+			[[maybe_unused]] auto& OptionValues = std::get<I>(Values);
+			((ParamIdx < PassedCount ? Convert(Parameters[ParamIdx], std::get<ParamIdx>(OptionValues)) : void()), ...);
 		}
 
-		// Parse the arguments
-		for(auto _Argument : ArgumentData){
-			_Argument.second.first->_ParseArg(_Argument.second.second);
+		// Calls Set for the option at a runtime index
+		template<std::size_t... I>
+		void SetAt(std::size_t Index, const std::string_view* Parameters, std::size_t ParameterCount, std::index_sequence<I...>){
+			((I == Index ? (Set<I>(Parameters, ParameterCount), true) : false) || ...);
+		}
+
+	public:
+		/**
+		 * @brief Gets the value of a parameter of an option
+		 * 
+		 * @tparam Option The option, as passed to the StaticParser
+		 * @tparam Idx The position of the parameter
+		 * @return const auto& The value, the default value if the option was not passed
+		 * @throws out_of_range exception if the option was not passed and has no default values
+		 */
+		template<const auto& Option, std::size_t Idx = 0>
+		const auto& Get() const {
+			constexpr std::size_t I = IndexOf<Option>();
+			static_assert(I < OptionCount, "Option is not part of the schema of this parser");
+			static_assert(Idx < OptionAt<I>::ParameterCount, "Parameter index is out of range for this option");
+			if(!Used[I] && !Option.has_defaultValues)
+				throw std::out_of_range(std::string(Option.Callee1) + " was not passed and has no default value");
+			return std::get<Idx>(std::get<I>(Values));
 		}
 
+		/**
+		 * @brief Boolean check for if the option was passed
+		 * 
+		 * @tparam Option The option, as passed to the StaticParser
+		 */
+		template<const auto& Option>
+		bool IsUsed() const {
+			constexpr std::size_t I = IndexOf<Option>();
+			static_assert(I < OptionCount, "Option is not part of the schema of this parser");
+			return Used[I];
+		}
+
+		/**
+		 * @brief Gets the value of a flag, like the value of a flag of ArgumentParser::addFlag
+		 * 
+		 * @tparam Option The flag, as passed to the StaticParser
+		 * @return true if the flag was passed and not followed by 0 or false
+		 */
+		template<const auto& Option>
+		bool IsSet() const {
+			constexpr std::size_t I = IndexOf<Option>();
+			static_assert(I < OptionCount, "Option is not part of the schema of this parser");
+			static_assert(OptionAt<I>::ParameterCount == 0, "IsSet is only available for flags, use Get for options with parameters");
+			return Used[I] && Flags[I];
+		}
+
+		/**
+		 * @brief Gets the operands, the tokens that are neither arguments nor parameters, see ParseResult::Operands
+		 * The range views the parsed tokens, which should outlive it.
+		 */
+		const TokenRange& Operands() const {return _Operands;}
+	};
+
+	/**
+	 * @brief Parses command line tokens without allocating
+	 * The first token is the program name and is skipped, like argv[0]. Operands are recorded in Result::Operands, which allocates 
+	 * once per stretch of consecutive operands.
+	 * @tparam T const char* or std::string_view
+	 * @param begin The first token
+	 * @param end The end of the tokens
+	 * @return Result The values of all options, std::string_view parameters view the tokens
+	 * @throws invalid_argument exception if a passed argument is unknown or a parameter can not be converted
+	 * @throws out_of_range exception if an option is passed with too few parameters and has no default values
+	 * @throws MissingRequiredParameter if any required options are missing
+	 */
+	template<typename T>
+	static Result Parse(const T* begin, const T* end){
+		Result Values;
+		// the parameters of an option, at most the largest parameter count of the schema
+		constexpr std::size_t MaxParameters = std::max({std::decay_t<decltype(Options)>::ParameterCount...});
+		std::array<std::string_view, MaxParameters + 1> Parameters{};
+		const T* p = begin == end ? end : begin + 1;
+		while(p != end){
+			const std::string_view Token = *p;
+			if(!IsArgumentToken(Token)){
+				Values._Operands.Add(p++);
+				continue;
+			}
+			p++;
+			// single dash with multiple arguments is a compound argument, every argument takes its parameters in turn
+			const bool Compound = Token[1] != '-' && Token.size() > 2;
+			for(std::size_t j = 1; j < (Compound ? Token.size() : 2); j++){
+				const std::size_t Index = Compound ? ShortTable[static_cast<unsigned char>(Token[j])] : FindCallee(Token);
+				if(Index == OptionCount)
+					ThrowUnknown(Compound ? "-" + std::string(1, Token[j]) : std::string(Token), Compound ? "-" + std::string(Token) : std::string(Token));
+				const std::size_t Count = ParameterCount(Index);
+				// a flag only takes a following 0, 1, true or false, so operands can follow it
+				bool Flag = true;
+				std::size_t n = 0;
+				// parameters are the following tokens up to the next argument, those beyond the parameter count are operands
+				for(; p != end && n < (Count ? Count : 1); p++, n++){
+					const std::string_view Parameter = *p;
+					if(!Count && !FastConvert(Parameter, Flag))
+						break;
+					if(IsArgumentToken(Parameter)){
+						if(Compound)
+							throw std::out_of_range("Not enough parameters for compound argument " + std::string(Token) + " use -h for help");
+						break;
+					}
+					if(Count)
+						Parameters[n] = Parameter;
+				}
+				Values.SetAt(Index, Parameters.data(), std::min(n, Count), std::make_index_sequence<OptionCount>());
+				Values.Flags[Index] = Flag;
+			}
+		}
+		constexpr bool RequiredOptions[] = {Options.required...};
+		bool Missing = false;
+		for(std::size_t i = 0; i < OptionCount; i++)
+			Missing = Missing || (RequiredOptions[i] && !Values.Used[i]);
+		if(Missing){
+			constexpr std::string_view Callees[] = {Options.Callee1...};
+			std::vector<std::string> MissingArguments;
+			for(std::size_t i = 0; i < OptionCount; i++)
+				if(RequiredOptions[i] && !Values.Used[i])
+					MissingArguments.emplace_back(Callees[i]);
+			throw MissingRequiredParameter("Not all required arguments were passed.", MissingArguments);
+		}
+		return Values;
 	}
 
 	/**
-	 * @brief Returns a reference to an argument specified by the key
-	 * 
-	 * @param ArgKey The key of the argument
-	 * @return Argument& A reference to the argument
-	 * @throws invalid_argument exception if the argument key does not exist
+	 * @brief Parses the command line arguments without allocating, see Parse(begin, end)
 	 */
-	Argument& operator[](std::string ArgKey){
-		auto _Arg = std::find_if(Arguments.begin(), Arguments.end(), [ArgKey](const auto& pair){
-			return pair.second == ArgKey;
-		});
-		if(_Arg == Arguments.end())
-			throw std::invalid_argument(ArgKey + " argument does not exist");
-		else
-			return _Arg->second;
+	static Result Parse(const int argc, const char** argv){return Parse(argv, argv + argc);}
+	/**
+	 * @brief Parses command line tokens without allocating, see Parse(begin, end)
+	 */
+	static Result Parse(const std::vector<std::string_view>& Tokens){return Parse(Tokens.data(), Tokens.data() + Tokens.size());}
+
+private:
+	// Gets the parameter count of the option at a runtime index
+	static std::size_t ParameterCount(std::size_t Index) noexcept {
+		constexpr std::size_t Counts[] = {std::decay_t<decltype(Options)>::ParameterCount...};
+		return Counts[Index];
 	}
 };
 
-
 } // end of namespace
 
 #undef CalleeLengthBeforeDescription
\ No newline at end of file
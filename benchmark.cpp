@@ -0,0 +1,972 @@
+// GCC reports the malloc/free pair behind the replaced global new and delete below as mismatched
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+#include "ArgumentParser.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <atomic>
+#include <thread>
+#include <new>
+
+// compile with g++ -O2 -pthread benchmark.cpp -o benchmark
+// Run with ./benchmark [filter], only benchmarks whose name contains filter are run.
+// Every measurement is written to stdout as a single line of JSON:
+// {"benchmark":"parse/long","options":1000,"tokens":10000,"unit":"token","operations":..,"ns_per_op":..,"allocs_per_op":..,"bytes_per_op":..}
+
+using namespace ArgPar;
+
+using Clock = std::chrono::steady_clock;
+
+// Counts every heap allocation made by the process
+static std::atomic<std::size_t> AllocationCount{0};
+static std::atomic<std::size_t> AllocatedBytes{0};
+void* operator new(std::size_t size){
+	AllocationCount.fetch_add(1, std::memory_order_relaxed);
+	AllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+	if(void* p = std::malloc(size ? size : 1))
+		return p;
+	throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+// Only benchmarks whose name contains the filter are run
+static std::string Filter;
+bool Enabled(const std::string& Benchmark){
+	return Benchmark.find(Filter) != std::string::npos;
+}
+
+struct Measurement {
+	std::size_t Operations = 0;
+	double Nanoseconds = 0;
+	std::size_t Allocations = 0;
+	std::size_t Bytes = 0;
+};
+
+// Minimum time spent per measurement
+const auto MeasureTime = std::chrono::milliseconds(200);
+
+/**
+ * @brief Calls f until MeasureTime has passed and at least once
+ * @param OperationsPerCall The amount of operations a single call of f performs, the results are reported per operation
+ */
+template<typename F>
+Measurement Measure(std::size_t OperationsPerCall, F&& f){
+	Measurement M;
+	const std::size_t AllocationsBefore = AllocationCount, BytesBefore = AllocatedBytes;
+	const auto start = Clock::now();
+	auto now = start;
+	do{
+		f();
+		M.Operations += OperationsPerCall;
+		now = Clock::now();
+	} while(now - start < MeasureTime);
+	M.Nanoseconds = std::chrono::duration<double, std::nano>(now - start).count();
+	M.Allocations = AllocationCount - AllocationsBefore;
+	M.Bytes = AllocatedBytes - BytesBefore;
+	return M;
+}
+
+// Writes a measurement as a single line of JSON
+void Report(const std::string& Benchmark, std::initializer_list<std::pair<const char*, std::size_t>> Parameters, const char* Unit, const Measurement& M){
+	std::ostringstream Line;
+	Line << "{\"benchmark\":\"" << Benchmark << "\"";
+	for(const auto& Parameter : Parameters)
+		Line << ",\"" << Parameter.first << "\":" << Parameter.second;
+	const double Operations = static_cast<double>(M.Operations);
+	Line << ",\"unit\":\"" << Unit << "\",\"operations\":" << M.Operations
+		 << ",\"ns_per_op\":" << M.Nanoseconds / Operations
+		 << ",\"allocs_per_op\":" << M.Allocations / Operations
+		 << ",\"bytes_per_op\":" << M.Bytes / Operations << "}\n";
+	std::cout << Line.str() << std::flush;
+}
+
+//?==== Synthetic schemas and command lines ====?//
+
+const std::size_t OptionCounts[] = {10, 100, 1000, 10000};
+const std::size_t TokenCounts[] = {1000, 10000, 100000};
+
+std::string OptionName(std::size_t i){
+	return "--opt" + std::to_string(i);
+}
+
+// Registers OptionCount long arguments named --opt0 ... --optN taking a single int, every RequiredEvery-th argument is required
+void BuildSchema(ArgumentParser& AP, std::size_t OptionCount, std::size_t RequiredEvery = 0){
+	for(std::size_t i = 0; i < OptionCount; i++){
+		Argument& A = AP.addArgument<int>(OptionName(i)).Help("Synthetic option number " + std::to_string(i));
+		if(RequiredEvery && i % RequiredEvery == 0)
+			A.Required();
+	}
+}
+
+// Owns the strings of a command line and the argv pointing at them
+struct CommandLine {
+	std::vector<std::string> Tokens{"bench"};
+	std::vector<const char*> argv;
+
+	void Add(std::string Token){Tokens.push_back(std::move(Token));}
+	void Finish(){
+		argv.clear();
+		for(const auto& Token : Tokens)
+			argv.push_back(Token.c_str());
+	}
+	int argc() const {return static_cast<int>(argv.size());}
+	std::size_t size() const {return Tokens.size() - 1;} // tokens excluding the program name
+};
+
+// Builds a command line of TokenCount tokens passing long options of a BuildSchema schema with their parameter
+CommandLine LongOptionCommandLine(std::size_t OptionCount, std::size_t TokenCount){
+	CommandLine CL;
+	for(std::size_t i = 0; CL.size() + 2 <= TokenCount; i++){
+		CL.Add(OptionName(i * 7 % OptionCount));
+		CL.Add(std::to_string(i));
+	}
+	CL.Finish();
+	return CL;
+}
+
+//?==== Benchmarks ====?//
+
+// Cost of adding arguments to a parser
+void BenchRegistration(){
+	if(!Enabled("register"))
+		return;
+	for(std::size_t OptionCount : OptionCounts){
+		std::vector<std::string> Names;
+		for(std::size_t i = 0; i < OptionCount; i++)
+			Names.push_back(OptionName(i));
+		Report("register", {{"options", OptionCount}}, "argument", Measure(OptionCount, [&](){
+			ArgumentParser AP("bench", 1, 0);
+			for(const auto& Name : Names)
+				AP.addArgument<int, std::string>(Name).DefaultValue(1, "default").Help("Synthetic option");
+		}));
+	}
+}
+
+// ParseArguments with long options, compound short flags and the required argument check
+void BenchParse(){
+	if(Enabled("parse/long")){
+		for(std::size_t OptionCount : OptionCounts){
+			ArgumentParser AP("bench", 1, 0);
+			BuildSchema(AP, OptionCount);
+			for(std::size_t TokenCount : TokenCounts){
+				CommandLine CL = LongOptionCommandLine(OptionCount, TokenCount);
+				Report("parse/long", {{"options", OptionCount}, {"tokens", CL.size()}}, "token", Measure(CL.size(), [&](){
+					AP.ParseArguments(CL.argc(), CL.argv.data());
+				}));
+			}
+		}
+	}
+
+	if(Enabled("parse/instrumented")){
+		// Same as parse/long with per phase timers and counters enabled
+		ArgumentParser AP("bench", 1, 0);
+		BuildSchema(AP, 1000);
+		CommandLine CL = LongOptionCommandLine(1000, 10000);
+		ParseInstrumentation Instrumentation;
+		Report("parse/instrumented", {{"options", 1000}, {"tokens", CL.size()}}, "token", Measure(CL.size(), [&](){
+			AP.ParseArguments(CL.argc(), CL.argv.data(), Instrumentation);
+		}));
+	}
+
+	if(Enabled("parse/compound")){
+		// Compound short arguments followed by the parameter of every argument: -abcdefgi 0 1 2 3 4 5 6 7
+		ArgumentParser AP("bench", 1, 0);
+		const std::string Letters = "abcdefgijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUWXYZ";
+		for(char c : Letters)
+			AP.addArgument<int>(std::string("-") + c);
+		for(std::size_t TokenCount : TokenCounts){
+			CommandLine CL;
+			for(std::size_t i = 0; CL.size() + 9 <= TokenCount; i++){
+				CL.Add("-" + Letters.substr(i % 8, 8));
+				for(std::size_t p = 0; p < 8; p++)
+					CL.Add(std::to_string(p));
+			}
+			CL.Finish();
+			Report("parse/compound", {{"arguments_per_token", 8}, {"tokens", CL.size()}}, "token", Measure(CL.size(), [&](){
+				AP.ParseArguments(CL.argc(), CL.argv.data());
+			}));
+		}
+	}
+
+	if(Enabled("parse/required")){
+		for(std::size_t OptionCount : OptionCounts){
+			ArgumentParser AP("bench", 1, 0);
+			BuildSchema(AP, OptionCount, 4);
+			// Pass every required argument
+			CommandLine All;
+			for(std::size_t i = 0; i < OptionCount; i += 4){
+				All.Add(OptionName(i));
+				All.Add(std::to_string(i));
+			}
+			All.Finish();
+			Report("parse/required", {{"options", OptionCount}, {"required", (OptionCount + 3) / 4}}, "parse", Measure(1, [&](){
+				AP.ParseArguments(All.argc(), All.argv.data());
+			}));
+			// Pass only the first required argument, parsing fails with MissingRequiredParameter
+			CommandLine Missing;
+			Missing.Add(OptionName(0));
+			Missing.Add("0");
+			Missing.Finish();
+			Report("parse/required-missing", {{"options", OptionCount}, {"required", (OptionCount + 3) / 4}}, "parse", Measure(1, [&](){
+				try{
+					AP.ParseArguments(Missing.argc(), Missing.argv.data());
+				}
+				catch(const MissingRequiredParameter&){}
+			}));
+		}
+	}
+}
+
+// Reading parsed values and looking up arguments
+void BenchAccess(){
+	if(!Enabled("access"))
+		return;
+	for(std::size_t OptionCount : OptionCounts){
+		ArgumentParser AP("bench", 1, 0);
+		BuildSchema(AP, OptionCount);
+		AP.addArgument<int, double>("--typed").Typed();
+		CommandLine CL = LongOptionCommandLine(OptionCount, std::min<std::size_t>(2 * OptionCount, 10000));
+		CL.Add("--typed");
+		CL.Add("42");
+		CL.Add("0.5");
+		CL.Finish();
+		AP.ParseArguments(CL.argc(), CL.argv.data());
+
+		std::vector<std::string> Names;
+		for(std::size_t i = 0; i < OptionCount; i++)
+			Names.push_back(OptionName(i));
+		const std::size_t Batch = 1000;
+		volatile long Sink = 0;
+
+		std::size_t n = 0;
+		Report("access/lookup", {{"options", OptionCount}}, "lookup", Measure(Batch, [&](){
+			for(std::size_t i = 0; i < Batch; i++)
+				Sink = Sink + AP[Names[n++ % OptionCount]].IsUsed();
+		}));
+		Argument& Used = AP[OptionName(0)];
+		Report("access/parse", {{"options", OptionCount}}, "conversion", Measure(Batch, [&](){
+			for(std::size_t i = 0; i < Batch; i++)
+				Sink = Sink + Used.Parse<int>(0);
+		}));
+		Argument& Typed = AP["--typed"];
+		Report("access/value", {{"options", OptionCount}}, "read", Measure(Batch, [&](){
+			for(std::size_t i = 0; i < Batch; i++)
+				Sink = Sink + Typed.Value<int>(0);
+		}));
+	}
+}
+
+// Rendering the help of every argument through operator<< and the help page
+void BenchHelp(){
+	if(!Enabled("help"))
+		return;
+	for(std::size_t OptionCount : OptionCounts){
+		ArgumentParser AP("bench", 1, 0);
+		BuildSchema(AP, OptionCount);
+		std::vector<Argument*> Arguments;
+		for(std::size_t i = 0; i < OptionCount; i++)
+			Arguments.push_back(&AP[OptionName(i)]);
+		Report("help/operator<<", {{"options", OptionCount}}, "argument", Measure(OptionCount, [&](){
+			std::ostringstream Help;
+			for(const Argument* A : Arguments)
+				Help << *A << '\n';
+		}));
+		// Rendering the whole help page, alternating the width invalidates the cache every time
+		std::size_t Width = 100;
+		Report("help/render", {{"options", OptionCount}}, "argument", Measure(OptionCount, [&](){
+			AP.HelpWidth(Width ^= 1);
+			std::ostringstream Help;
+			AP.PrintHelp(Help);
+		}));
+		Report("help/cached", {{"options", OptionCount}}, "argument", Measure(OptionCount, [&](){
+			std::ostringstream Help;
+			AP.PrintHelp(Help);
+		}));
+	}
+}
+
+// Compares the from_chars conversion path with the operator>> path on numeric tokens
+template<typename T>
+void BenchConversion(const std::string& Name, const std::vector<std::string>& Tokens){
+	volatile T Sink{};
+	Report("convert/" + Name + "/ToType", {{"tokens", Tokens.size()}}, "conversion", Measure(Tokens.size(), [&](){
+		for(const auto& Token : Tokens)
+			Sink = ToType<T>(Token);
+	}));
+	Report("convert/" + Name + "/StreamToType", {{"tokens", Tokens.size()}}, "conversion", Measure(Tokens.size(), [&](){
+		for(const auto& Token : Tokens)
+			Sink = StreamToType<T>(Token);
+	}));
+	(void)Sink;
+}
+
+void BenchConversions(){
+	if(!Enabled("convert"))
+		return;
+	const std::size_t TokenCount = 1000000;
+	std::vector<std::string> Integers, Floats;
+	Integers.reserve(TokenCount);
+	Floats.reserve(TokenCount);
+	for(std::size_t i = 0; i < TokenCount; i++){
+		Integers.push_back(std::to_string(static_cast<long>(i * 2654435761u % 2000000) - 1000000));
+		Floats.push_back(std::to_string((i % 100000) * 0.125));
+	}
+	BenchConversion<int>("int", Integers);
+	BenchConversion<long>("long", Integers);
+	BenchConversion<double>("double", Floats);
+	BenchConversion<float>("float", Floats);
+}
+
+// Parses the same command line against one shared parser from multiple threads
+void BenchConcurrentParse(){
+	if(!Enabled("concurrent"))
+		return;
+	ArgumentParser AP("bench", 1, 0);
+	BuildSchema(AP, 1000);
+	AP.addArgument<std::string, int>("-i", "--input").Typed();
+	AP.addFlag("-v", "--verbose");
+	const char* argv[] = {"bench", "--opt1", "1", "--opt500", "2", "-i", "file.txt", "3", "-v", "--opt999", "4"};
+	const int argc = sizeof(argv) / sizeof(argv[0]);
+
+	const std::size_t ParsesPerThread = 1000;
+	for(std::size_t ThreadCount : {1, 2, 4, 8}){
+		Report("concurrent/parse", {{"options", 1000}, {"threads", ThreadCount}}, "parse", Measure(ThreadCount * ParsesPerThread, [&](){
+			std::vector<std::thread> Threads;
+			for(std::size_t t = 0; t < ThreadCount; t++)
+				Threads.emplace_back([&](){
+					for(std::size_t i = 0; i < ParsesPerThread; i++){
+						ParseResult Result = AP.Parse(argc, argv);
+						volatile int value = Result["-i"].Value<int>(1);
+						(void)value;
+					}
+				});
+			for(auto& Thread : Threads)
+				Thread.join();
+		}));
+	}
+}
+
+// Parses a buffer of recorded command lines with an increasing amount of threads
+void BenchBatchParse(){
+	if(!Enabled("batch"))
+		return;
+	ArgumentParser AP("bench", 1, 0);
+	BuildSchema(AP, 1000);
+	AP.addArgument<std::string, int>("-i", "--input").Typed();
+	AP.addFlag("-v", "--verbose");
+	std::string Buffer;
+	const std::size_t LineCount = 100000;
+	for(std::size_t i = 0; i < LineCount; i++)
+		Buffer += "bench " + OptionName(i % 1000) + " " + std::to_string(i) + " -i 'input " + std::to_string(i) + ".txt' 3 -v\n";
+
+	for(std::size_t ThreadCount : {1, 2, 4, 8}){
+		Report("batch/parse", {{"options", 1000}, {"lines", LineCount}, {"threads", ThreadCount}}, "line", Measure(LineCount, [&](){
+			BatchResult Result = BatchParser(AP, ThreadCount).ParseBuffer(Buffer);
+			if(Result.ErrorCount())
+				throw std::runtime_error("batch benchmark lines failed to parse");
+		}));
+	}
+}
+
+// Resident memory of the process in KiB, 0 where unknown
+std::size_t ResidentKiB(){
+	std::ifstream Status("/proc/self/statm");
+	std::size_t Pages = 0, Resident = 0;
+	if(Status >> Pages >> Resident)
+		return Resident * 4;
+	return 0;
+}
+
+// Parses response files of up to 1 GiB holding a path list for an argument, read through a memory mapping
+void BenchResponseFiles(){
+	if(!Enabled("responsefile"))
+		return;
+	ArgumentParser AP("bench", 1, 0);
+	BuildSchema(AP, 1000);
+	AP.addArgument<std::string>("--paths");
+	AP.ResponseFiles();
+	const std::string Path = "argpar_benchmark_response.txt";
+	for(std::size_t Megabytes : {64, 1024}){
+		const std::size_t Size = Megabytes * 1024 * 1024;
+		{
+			std::ofstream File(Path, std::ios::binary | std::ios::trunc);
+			std::string Chunk;
+			for(std::size_t i = 0; i < 1000; i++)
+				Chunk += OptionName(i) + " " + std::to_string(i) + "\n";
+			Chunk += "--paths\n";
+			std::size_t Written = 0;
+			for(std::size_t i = 0; Written < Size; i++){
+				if(i % 10 == 0)
+					Chunk += "'/data/recordings/quoted path/session_" + std::to_string(i) + ".bin'\n";
+				else
+					Chunk += "/data/recordings/2024/session_" + std::to_string(i) + "/input_file.bin\n";
+				if(Chunk.size() >= 1 << 20 || Written + Chunk.size() >= Size){
+					File.write(Chunk.data(), static_cast<std::streamsize>(Chunk.size()));
+					Written += Chunk.size();
+					Chunk.clear();
+				}
+			}
+		}
+		const std::string Argument = "@" + Path;
+		const char* argv[] = {"bench", Argument.c_str()};
+		const std::size_t ResidentBefore = ResidentKiB();
+		Measurement M = Measure(Size, [&](){
+			AP.ParseArguments(2, argv);
+		});
+		Report("responsefile/parse", {{"bytes", Size}, {"resident_growth_kib", ResidentKiB() - std::min(ResidentBefore, ResidentKiB())}}, "byte", M);
+	}
+	std::remove(Path.c_str());
+}
+
+// Daemon startup: loading a config file of one line per option and parsing an almost empty command line on top of it
+void BenchConfig(){
+	if(!Enabled("config"))
+		return;
+	const std::string Path = "argpar_benchmark.conf";
+	for(std::size_t OptionCount : OptionCounts){
+		ArgumentParser AP("bench", 1, 0);
+		BuildSchema(AP, OptionCount);
+		{
+			std::ofstream File(Path, std::ios::trunc);
+			for(std::size_t i = 0; i < OptionCount; i++)
+				File << (i % 10 == 0 ? "# setting " + std::to_string(i) + "\n" : "") << OptionName(i).substr(2) << " = " << i << "\n";
+		}
+		ArgumentParser Loader("bench", 1, 0);
+		BuildSchema(Loader, OptionCount);
+		Report("config/load", {{"options", OptionCount}, {"lines", OptionCount}}, "line", Measure(OptionCount, [&](){
+			Loader.ConfigFile(Path); // every load adds a layer on top of the previous ones
+		}));
+		AP.ConfigFile(Path);
+		const char* argv[] = {"bench", "--opt1", "1"};
+		Report("config/parse", {{"options", OptionCount}, {"lines", OptionCount}}, "parse", Measure(1, [&](){
+			AP.ParseArguments(3, argv);
+		}));
+	}
+	std::remove(Path.c_str());
+}
+
+// Tokenizes multi-megabyte command lines with the scalar and the vectorized scanner
+void BenchTokenizers(){
+	if(!Enabled("tokenize"))
+		return;
+	for(std::size_t Megabytes : {1, 8, 32}){
+		std::string Line = "bench";
+		for(std::size_t i = 0; Line.size() < Megabytes * 1024 * 1024; i++){
+			if(i % 10 == 0)
+				Line += " --title \"A quoted title with \\\"escapes\\\" number " + std::to_string(i) + "\"";
+			else if(i % 10 == 1)
+				Line += " 'single quoted/path with spaces/" + std::to_string(i) + "'";
+			else
+				Line += " /data/recordings/2024/session_" + std::to_string(i) + "/input_file.bin";
+		}
+		std::vector<std::string_view> Tokens;
+		std::unique_ptr<char[]> Storage;
+		Report("tokenize/ScalarScan", {{"bytes", Line.size()}}, "byte", Measure(Line.size(), [&](){
+			Tokenize<ScalarScan>(Line, Tokens, Storage);
+		}));
+		Report("tokenize/DefaultScan", {{"bytes", Line.size()}}, "byte", Measure(Line.size(), [&](){
+			Tokenize<DefaultScan>(Line, Tokens, Storage);
+		}));
+	}
+}
+
+// Parses command lines of file operands and repeated options, the operands and values are kept as runs of argv and read while iterating
+void BenchOperands(){
+	if(!Enabled("operands"))
+		return;
+	ArgumentParser AP("bench", 1, 0);
+	AP.addArgument<std::string>("-i", "--include").Repeatable();
+	AP.addArgument<int>("-j");
+	for(std::size_t OperandCount : {1000, 100000, 500000}){
+		CommandLine CL;
+		CL.Add("-j");
+		CL.Add("4");
+		for(std::size_t i = 0; i < OperandCount; i++)
+			CL.Add("/data/recordings/session_" + std::to_string(i) + ".bin");
+		CL.Finish();
+		Report("operands/parse", {{"operands", OperandCount}, {"tokens", CL.size()}}, "token", Measure(CL.size(), [&](){
+			AP.ParseArguments(CL.argc(), CL.argv.data());
+		}));
+		std::size_t Bytes = 0;
+		Report("operands/iterate", {{"operands", OperandCount}}, "token", Measure(OperandCount, [&](){
+			for(std::string_view Operand : AP.Operands())
+				Bytes += Operand.size();
+		}));
+		if(!Bytes)
+			std::abort();
+	}
+	for(std::size_t Repeats : {1000, 100000}){
+		CommandLine CL;
+		for(std::size_t i = 0; i < Repeats; i++){
+			CL.Add("-i");
+			CL.Add("include/path_" + std::to_string(i));
+		}
+		CL.Finish();
+		Report("operands/repeated", {{"repeats", Repeats}, {"tokens", CL.size()}}, "token", Measure(CL.size(), [&](){
+			AP.ParseArguments(CL.argc(), CL.argv.data());
+		}));
+	}
+}
+
+// Feeds a stream of long options with their parameter in chunks of different sizes
+void BenchIncremental(){
+	if(!Enabled("incremental"))
+		return;
+	ArgumentParser AP("bench", 1, 0);
+	BuildSchema(AP, 1000);
+	std::string Stream;
+	for(std::size_t i = 0; Stream.size() < 8 * 1024 * 1024; i++)
+		Stream += OptionName(i * 7 % 1000) + " " + std::to_string(i) + (i % 16 ? " " : "\n");
+	IncrementalParser<> Parser(AP);
+	for(std::size_t ChunkSize : {16, 4096, 65536}){
+		Report("incremental/feed", {{"chunk_bytes", ChunkSize}, {"bytes", Stream.size()}}, "byte", Measure(Stream.size(), [&](){
+			for(std::size_t pos = 0; pos < Stream.size(); pos += ChunkSize)
+				Parser.Feed(std::string_view(Stream).substr(pos, ChunkSize));
+			Parser.Finish();
+		}));
+	}
+}
+
+// Checks the required arguments and constraints of large schemas, every 4th option is required and every 10 options form a constraint
+void BenchConstraints(){
+	if(!Enabled("constraints"))
+		return;
+	for(std::size_t OptionCount : OptionCounts){
+		ArgumentParser AP("bench", 1, 0);
+		BuildSchema(AP, OptionCount, 4);
+		std::vector<std::string> Names;
+		for(std::size_t i = 0; i < OptionCount; i++)
+			Names.push_back(OptionName(i));
+		std::size_t ConstraintCount = 0;
+		for(std::size_t i = 1; i + 3 < OptionCount; i += 10, ConstraintCount++){
+			switch(ConstraintCount % 3){
+			case 0: AP.MutuallyExclusive({Names[i], Names[i + 1], Names[i + 2]}); break;
+			case 1: AP.Requires(Names[i], {Names[i + 1]}); break;
+			case 2: AP.ConflictsWith(Names[i], {Names[i + 2]}); break;
+			}
+		}
+		// Every required argument and the first member of every constraint
+		CommandLine CL;
+		for(std::size_t i = 0; i < OptionCount; i += 4){
+			CL.Add(OptionName(i));
+			CL.Add("1");
+		}
+		CL.Finish();
+		Report("constraints/parse", {{"options", OptionCount}, {"constraints", ConstraintCount}, {"tokens", CL.size()}}, "parse", Measure(1, [&](){
+			AP.ParseArguments(CL.argc(), CL.argv.data());
+		}));
+	}
+}
+
+// Runs blocking validators serially and on an increasing amount of threads, with the arguments spread over a number of priority levels
+void BenchConcurrentActions(){
+	if(!Enabled("actions"))
+		return;
+	const std::size_t OptionCount = 64;
+	// Blocks for 100 us, standing in for a validator that checks a file or resolves an address
+	auto Validate = [](const std::vector<std::string>&){
+		std::this_thread::sleep_for(std::chrono::microseconds(100));
+		return std::size_t(0);
+	};
+	CommandLine CL;
+	for(std::size_t i = 0; i < OptionCount; i++){
+		CL.Add(OptionName(i));
+		CL.Add(std::to_string(i));
+	}
+	CL.Finish();
+	for(std::size_t Levels : {1, 8}){
+		for(std::size_t ThreadCount : {1, 2, 4, 8}){
+			ArgumentParser AP("bench", 1, 0);
+			BuildSchema(AP, OptionCount);
+			for(std::size_t i = 0; i < OptionCount; i++)
+				AP[OptionName(i)].Validator(Validate).priority(i % Levels);
+			AP.ConcurrentActions(ThreadCount);
+			Report("actions/validate", {{"options", OptionCount}, {"levels", Levels}, {"threads", ThreadCount}}, "parse", Measure(1, [&](){
+				AP.ParseArguments(CL.argc(), CL.argv.data());
+			}));
+		}
+	}
+}
+
+// Startup of a multi tool: registering the subcommands and parsing one of them, compared to registering every option in one flat parser
+void BenchSubcommands(){
+	if(!Enabled("subcommands"))
+		return;
+	const std::size_t OptionsPerCommand = 20;
+	const char* argv[] = {"bench", "cmd7", "--opt1", "1", "--opt19", "2"};
+	const char* FlatArgv[] = {"bench", "--cmd7-opt1", "1", "--cmd7-opt19", "2"};
+	const int argc = sizeof(argv) / sizeof(argv[0]);
+	for(std::size_t CommandCount : {10, 100, 1000, 10000}){
+		Report("subcommands/startup", {{"commands", CommandCount}, {"options", OptionsPerCommand}}, "startup", Measure(1, [&](){
+			ArgumentParser AP("bench", 1, 0);
+			for(std::size_t i = 0; i < CommandCount; i++)
+				AP.AddSubcommand("cmd" + std::to_string(i), [](ArgumentParser& Sub){BuildSchema(Sub, OptionsPerCommand);});
+			AP.ParseArguments(argc, argv);
+		}));
+		if(CommandCount > 1000)
+			continue;
+		Report("subcommands/flat", {{"commands", CommandCount}, {"options", OptionsPerCommand}}, "startup", Measure(1, [&](){
+			ArgumentParser AP("bench", 1, 0);
+			for(std::size_t i = 0; i < CommandCount; i++)
+				for(std::size_t j = 0; j < OptionsPerCommand; j++)
+					AP.addArgument<int>("--cmd" + std::to_string(i) + "-opt" + std::to_string(j)).Help("Synthetic option number " + std::to_string(j));
+			AP.ParseArguments(argc - 1, FlatArgv);
+		}));
+	}
+}
+
+// Answers completion queries and parses abbreviated callees against schemas of increasing size
+void BenchCompletion(){
+	if(!Enabled("complete"))
+		return;
+	for(std::size_t OptionCount : OptionCounts){
+		ArgumentParser AP("bench", 1, 0);
+		BuildSchema(AP, OptionCount);
+		AP.addArgument<int>("--unique-option");
+		AP.Abbreviations();
+
+		std::vector<std::string> Names;
+		for(std::size_t i = 0; i < OptionCount; i++)
+			Names.push_back(OptionName(i));
+		std::vector<CalleeTrie::Entry> Entries;
+		for(const std::string& Name : Names)
+			Entries.emplace_back(Name, nullptr); // only the callees are needed
+		Report("complete/build", {{"options", OptionCount}}, "build", Measure(1, [&](){
+			CalleeTrie Trie;
+			Trie.Assign(Entries);
+		}));
+
+		// Completes to every tenth option and to a single option
+		for(const std::string& Prefix : {std::string("--opt1"), OptionName(OptionCount - 1)}){
+			const std::size_t Matches = AP.Complete({Prefix}).size();
+			Report("complete/query", {{"options", OptionCount}, {"matches", Matches}}, "query", Measure(100, [&](){
+				for(int i = 0; i < 100; i++)
+					if(AP.Complete({Prefix}).size() != Matches)
+						std::abort();
+			}));
+		}
+
+		const char* argv[] = {"bench", "--opt1", "1", "--unique-option", "2"};
+		const char* AbbreviatedArgv[] = {"bench", "--opt1", "1", "--uniq", "2"};
+		Report("complete/exact", {{"options", OptionCount}}, "parse", Measure(1, [&](){
+			AP.ParseArguments(5, argv);
+		}));
+		Report("complete/abbreviated", {{"options", OptionCount}}, "parse", Measure(1, [&](){
+			AP.ParseArguments(5, AbbreviatedArgv);
+		}));
+	}
+}
+
+// Measures the error path of an unknown argument, a typo of an existing option and a token resembling none
+void BenchSuggestions(){
+	if(!Enabled("suggest"))
+		return;
+	for(std::size_t OptionCount : OptionCounts){
+		ArgumentParser AP("bench", 1, 0);
+		BuildSchema(AP, OptionCount);
+		AP.addArgument<int>("--unique-option");
+
+		for(const char* Unknown : {"--uniqeu-option", "--xyzzy-plugh"}){
+			const char* argv[] = {"bench", "--opt1", "1", Unknown, "2"};
+			std::size_t Suggestions = 0;
+			try{ AP.ParseArguments(5, argv); }
+			catch(const UnknownArgument& e){ Suggestions = e.Suggestions().size(); }
+			Report("suggest/unknown", {{"options", OptionCount}, {"suggestions", Suggestions}}, "parse", Measure(1, [&](){
+				try{
+					AP.ParseArguments(5, argv);
+					std::abort();
+				}
+				catch(const UnknownArgument& e){
+					if(e.Suggestions().size() != Suggestions)
+						std::abort();
+				}
+			}));
+		}
+	}
+}
+
+// Parses a mix of failing command lines with the throwing and the exception free API, as a server handling untrusted input does
+void BenchErrors(){
+	if(!Enabled("errors"))
+		return;
+	for(std::size_t OptionCount : OptionCounts){
+		ArgumentParser AP("bench", 1, 0);
+		BuildSchema(AP, OptionCount);
+		AP.addArgument<int>("--limit").Validator([](const std::vector<std::string>& Parameters) -> std::size_t {
+			return Parameters[0].size() > 3;
+		});
+		// an unknown option, missing parameters, a failing validator and a valid command line
+		const std::vector<std::vector<std::string_view>> Lines = {
+			{"bench", "--opt1", "1", "--no-such-option", "2"},
+			{"bench", "--opt1", "1", "--opt2"},
+			{"bench", "--opt1", "1", "--limit", "100000"},
+			{"bench", "--opt1", "1", "--limit", "10"}
+		};
+		Report("errors/throw", {{"options", OptionCount}, {"lines", Lines.size()}}, "parse", Measure(Lines.size(), [&](){
+			std::size_t Failed = 0;
+			for(const auto& Line : Lines){
+				try{ AP.Parse(Line); }
+				catch(const std::exception& e){ Failed += e.what()[0] != 0; }
+			}
+			if(Failed != 3)
+				std::abort();
+		}));
+		Report("errors/try", {{"options", OptionCount}, {"lines", Lines.size()}}, "parse", Measure(Lines.size(), [&](){
+			std::size_t Failed = 0;
+			for(const auto& Line : Lines)
+				Failed += !AP.TryParse(Line);
+			if(Failed != 3)
+				std::abort();
+		}));
+		// only the failing lines, their allocations are those of the scan up to the failing token
+		const std::vector<std::vector<std::string_view>> Failing(Lines.begin(), Lines.end() - 1);
+		Report("errors/try_failing", {{"options", OptionCount}, {"lines", Failing.size()}}, "parse", Measure(Failing.size(), [&](){
+			std::size_t Failed = 0;
+			for(const auto& Line : Failing)
+				Failed += !AP.TryParse(Line);
+			if(Failed != Failing.size())
+				std::abort();
+		}));
+		Report("errors/try_message", {{"options", OptionCount}, {"lines", Lines.size()}}, "parse", Measure(Lines.size(), [&](){
+			std::size_t Failed = 0;
+			for(const auto& Line : Lines){
+				ParseOutcome Outcome = AP.TryParse(Line);
+				if(!Outcome)
+					Failed += !Outcome.Error().Message().empty();
+			}
+			if(Failed != 3)
+				std::abort();
+		}));
+	}
+}
+
+// Log levels of the converter benchmark, converted by name through EnumNames
+enum class BenchLevel { Trace, Debug, Info, Notice, Warning, Error, Critical, Fatal };
+template<> struct ArgPar::EnumNames<BenchLevel> {
+	static constexpr auto Table = MakeEnumTable<BenchLevel>({
+		{"trace", BenchLevel::Trace}, {"debug", BenchLevel::Debug}, {"info", BenchLevel::Info}, {"notice", BenchLevel::Notice},
+		{"warning", BenchLevel::Warning}, {"error", BenchLevel::Error}, {"critical", BenchLevel::Critical}, {"fatal", BenchLevel::Fatal}
+	});
+};
+
+// Converts tokens through the registered converters, none of them should allocate
+template<typename T>
+void BenchConverter(const std::string& Name, const std::vector<std::string>& Tokens){
+	std::size_t Sink = 0;
+	Report("converters/" + Name, {{"tokens", Tokens.size()}}, "conversion", Measure(Tokens.size(), [&](){
+		for(const auto& Token : Tokens){
+			const T Value = ToType<T>(Token);
+			Sink += *reinterpret_cast<const unsigned char*>(&Value) + 1;
+		}
+	}));
+	if(!Sink)
+		std::abort();
+}
+
+void BenchConverters(){
+	if(!Enabled("converters"))
+		return;
+	const std::size_t TokenCount = 100000;
+	const char* LevelNames[] = {"trace", "debug", "info", "notice", "warning", "error", "critical", "fatal"};
+	const char* SizeUnits[] = {"", "KiB", "M", "GB", "k"};
+	const char* DurationUnits[] = {"ms", "s", "us", "m", "h"};
+	std::vector<std::string> Levels, Sizes, Durations, IPv4s, IPv6s;
+	for(std::size_t i = 0; i < TokenCount; i++){
+		Levels.push_back(LevelNames[i % 8]);
+		Sizes.push_back(std::to_string(i % 4096) + SizeUnits[i % 5]);
+		Durations.push_back(i % 3 ? std::to_string(i % 1000) + DurationUnits[i % 5] : std::to_string(i % 24) + "h" + std::to_string(i % 60) + "m");
+		IPv4s.push_back("10." + std::to_string(i >> 16 & 255) + "." + std::to_string(i >> 8 & 255) + "." + std::to_string(i & 255));
+		IPv6s.push_back(i % 2 ? "2001:db8::" + std::to_string(i % 10000) : "fe80:0:0:1:" + std::to_string(i % 10000) + ":0:0:1");
+	}
+	BenchConverter<BenchLevel>("enum", Levels);
+	// the usual alternative to a perfect hash over the names, a hash map keyed by the name
+	std::unordered_map<std::string, BenchLevel> LevelMap;
+	for(const auto& Entry : EnumNames<BenchLevel>::Table)
+		LevelMap.emplace(Entry.Name, Entry.Value);
+	std::size_t Sink = 0;
+	Report("converters/enum/unordered_map", {{"tokens", Levels.size()}}, "conversion", Measure(Levels.size(), [&](){
+		for(const auto& Token : Levels)
+			Sink += static_cast<std::size_t>(LevelMap.find(Token)->second);
+	}));
+	if(!Sink)
+		std::abort();
+	BenchConverter<ByteSize>("bytesize", Sizes);
+	BenchConverter<std::chrono::nanoseconds>("duration", Durations);
+	BenchConverter<IPv4Address>("ipv4", IPv4s);
+	BenchConverter<IPv6Address>("ipv6", IPv6s);
+}
+
+// Memory footprint of a schema, as reported by MemoryUsage and as allocated while building it
+void BenchMemory(){
+	if(!Enabled("memory"))
+		return;
+	for(std::size_t OptionCount : OptionCounts){
+		const std::size_t AllocationsBefore = AllocationCount, BytesBefore = AllocatedBytes;
+		ArgumentParser AP("bench", 1, 0);
+		for(std::size_t i = 0; i < OptionCount; i++)
+			AP.addArgument<int, std::string>(OptionName(i)).DefaultValue(1, "default").Help("Synthetic option");
+		const double Allocations = static_cast<double>(AllocationCount - AllocationsBefore);
+		const double Bytes = static_cast<double>(AllocatedBytes - BytesBefore);
+		const MemoryReport Usage = AP.MemoryUsage();
+		std::ostringstream Line;
+		Line << "{\"benchmark\":\"memory\",\"options\":" << OptionCount << ",\"unit\":\"argument\""
+			 << ",\"bytes_per_arg\":" << Usage.BytesPerArgument() << ",\"object_bytes\":" << Usage.ArgumentBytes
+			 << ",\"table_bytes\":" << Usage.TableBytes << ",\"string_bytes\":" << Usage.StringBytes << ",\"strings\":" << Usage.Strings
+			 << ",\"index_bytes\":" << Usage.IndexBytes << ",\"allocs_per_arg\":" << Allocations / OptionCount 
+			 << ",\"allocated_per_arg\":" << Bytes / OptionCount << "}\n";
+		std::cout << Line.str() << std::flush;
+	}
+}
+
+// Startup of a tool with a large schema: registering options of mixed types with defaults and parsing a short command line
+void BenchStartup(){
+	if(!Enabled("startup"))
+		return;
+	const std::size_t OptionCount = 5000;
+	std::vector<std::string> Names;
+	for(std::size_t i = 0; i < OptionCount; i++)
+		Names.push_back(OptionName(i));
+	const char* argv[] = {"bench", "--opt0", "7", "--opt1", "0.5", "--opt2", "--opt3", "name", "--opt4", "error"};
+	const int argc = sizeof(argv) / sizeof(argv[0]);
+	Report("startup", {{"options", OptionCount}}, "startup", Measure(1, [&](){
+		ArgumentParser AP("bench", 1, 0);
+		for(std::size_t i = 0; i < OptionCount; i += 5){
+			AP.addArgument<int>(Names[i]).DefaultValue(8080).Help("Synthetic port");
+			AP.addArgument<double>(Names[i + 1]).DefaultValue(1.5).Help("Synthetic rate");
+			AP.addFlag(Names[i + 2]).Help("Synthetic switch");
+			AP.addArgument<std::string>(Names[i + 3]).DefaultValue("default").Help("Synthetic name");
+			AP.addArgument<BenchLevel>(Names[i + 4]).DefaultValue(BenchLevel::Info).Help("Synthetic level");
+		}
+		AP.ParseArguments(argc, argv);
+		if(AP["--opt0"].Parse<int>(0) != 7 || AP["--opt5"].Parse<int>(0) != 8080)
+			std::abort();
+	}));
+}
+
+// Reads settings through typed handles from many threads, with the settings published once or republished while reading
+void BenchSettings(){
+	if(!Enabled("settings"))
+		return;
+	ArgumentParser AP("bench", 1, 0);
+	BuildSchema(AP, 1000);
+	ArgumentHandle<int> Port = AP.addArgument<int>("--port").DefaultValue(8080);
+	ArgumentHandle<double> Rate = AP.addArgument<double>("--rate").DefaultValue(1.5);
+	ArgumentHandle<std::string> Host = AP.addArgument<std::string>("--host").DefaultValue("localhost");
+	const char* argv[] = {"bench", "--port", "443", "--rate", "0.5", "--opt500", "2"};
+	const int argc = sizeof(argv) / sizeof(argv[0]);
+
+	// reading the same values by callee from the parser, single threaded
+	AP.ParseArguments(argc, argv);
+	const std::size_t ReadsPerCall = 1000;
+	Report("settings/lookup", {{"options", 1003}, {"threads", 1}}, "read", Measure(ReadsPerCall, [&](){
+		for(std::size_t i = 0; i < ReadsPerCall; i++){
+			volatile std::size_t value = AP["--port"].Parse<int>(0) + static_cast<std::size_t>(AP["--rate"].Parse<double>(0)) + AP["--host"].View(0).size();
+			(void)value;
+		}
+	}));
+
+	AP.Publish(argc, argv);
+	const std::size_t ReadsPerThread = 100000;
+	for(bool Reload : {false, true}){
+		for(std::size_t ThreadCount : {1, 64}){
+			std::size_t Publishes = 0;
+			const Measurement M = Measure(ThreadCount * ReadsPerThread, [&](){
+				std::atomic<std::size_t> Running{ThreadCount};
+				std::thread Writer;
+				if(Reload)
+					Writer = std::thread([&](){
+						while(Running.load()){
+							AP.Publish(argc, argv);
+							Publishes++;
+						}
+					});
+				std::vector<std::thread> Readers;
+				for(std::size_t t = 0; t < ThreadCount; t++)
+					Readers.emplace_back([&](){
+						for(std::size_t i = 0; i < ReadsPerThread; i++){
+							const PinnedSettings Settings = AP.Settings();
+							volatile std::size_t value = Port.Get(Settings) + static_cast<std::size_t>(Rate.Get(Settings)) + Host.Get(Settings).size();
+							(void)value;
+						}
+						Running--;
+					});
+				for(auto& Reader : Readers)
+					Reader.join();
+				if(Writer.joinable())
+					Writer.join();
+			});
+			Report(Reload ? "settings/read_reload" : "settings/read", {{"options", 1003}, {"threads", ThreadCount}, {"publishes", Publishes}}, "read", M);
+		}
+	}
+}
+
+// Options of the compile time schema benchmark, a StaticParser refers to them by address
+constexpr auto StaticPort = StaticOption<int>("-p", "--port").DefaultValue(8080);
+constexpr auto StaticHost = StaticOption<std::string_view>("-H", "--host").Required();
+constexpr auto StaticRate = StaticOption<double, double>("--rate").DefaultValue(1.0, 2.0);
+constexpr auto StaticLevel = StaticOption<char>("-l", "--level").DefaultValue('i');
+constexpr auto StaticVerbose = StaticFlag("-v", "--verbose");
+constexpr auto StaticQuiet = StaticFlag("-q", "--quiet");
+constexpr auto StaticRetries = StaticOption<unsigned>("-r", "--retries").DefaultValue(3u);
+constexpr auto StaticSecure = StaticOption<bool>("--secure").DefaultValue(false);
+
+// Parses the same command line with a compile time schema and with the equivalent runtime schema
+void BenchStaticSchema(){
+	if(!Enabled("static"))
+		return;
+	const char* argv[] = {"bench", "--host", "example.org", "-p", "443", "--rate", "0.5", "1.5", "-v", "-q", "-l", "d", "--retries", "5", "--secure", "true"};
+	const int argc = sizeof(argv) / sizeof(argv[0]);
+	using Parser = StaticParser<StaticPort, StaticHost, StaticRate, StaticLevel, StaticVerbose, StaticQuiet, StaticRetries, StaticSecure>;
+	Report("static/parse", {{"options", 8}, {"tokens", argc - 1}}, "parse", Measure(1, [&](){
+		auto Result = Parser::Parse(argc, argv);
+		if(Result.Get<StaticPort>() != 443)
+			std::abort();
+	}));
+
+	ArgumentParser AP("bench", 1, 0);
+	AP.addArgument<int>("-p", "--port").DefaultValue(8080);
+	AP.addArgument<std::string>("-H", "--host").Required();
+	AP.addArgument<double, double>("--rate").DefaultValue(1.0, 2.0);
+	AP.addArgument<char>("-l", "--level").DefaultValue('i');
+	AP.addFlag("-v", "--verbose");
+	AP.addFlag("-q", "--quiet");
+	AP.addArgument<unsigned>("-r", "--retries").DefaultValue(3u);
+	AP.addArgument<bool>("--secure").DefaultValue(false);
+	Report("static/runtime", {{"options", 8}, {"tokens", argc - 1}}, "parse", Measure(1, [&](){
+		AP.ParseArguments(argc, argv);
+		if(AP["--port"].Parse<int>(0) != 443)
+			std::abort();
+	}));
+}
+
+int main(int argc, const char* argv[]){
+	if(argc > 1)
+		Filter = argv[1];
+	BenchRegistration();
+	BenchParse();
+	BenchAccess();
+	BenchHelp();
+	BenchConversions();
+	BenchConcurrentParse();
+	BenchBatchParse();
+	BenchTokenizers();
+	BenchResponseFiles();
+	BenchConfig();
+	BenchStaticSchema();
+	BenchOperands();
+	BenchIncremental();
+	BenchConstraints();
+	BenchConcurrentActions();
+	BenchSubcommands();
+	BenchCompletion();
+	BenchSuggestions();
+	BenchErrors();
+	BenchConverters();
+	BenchMemory();
+	BenchStartup();
+	BenchSettings();
+	return 0;
+}
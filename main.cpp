@@ -20,7 +20,8 @@ int main(int argc, const char* argv[]){
 			  "I don't need to be passed to have values because of my default values,\n"\
 			  "you can also pass between 0 and 4 parameters after which my other values are set by implicit values!")
 		.ImplicitValue(10, 0.5, 'h', -404)
-		.DefaultValue(0, 0, 0, 0);
+		.DefaultValue(0, 0, 0, 0)
+		.Typed(); // convert the parameters once while parsing instead of on every access
 
 	// example of an argument with validator to check if value is between 0 and 10
 	AP.addArgument<int>("-J")
@@ -66,7 +67,7 @@ int main(int argc, const char* argv[]){
 	std::cout << AP["-I"].Parse<unsigned int>(0) << " ";
 	std::cout << AP["-I"].Parse<float>(1) << " ";
 	std::cout << AP["-I"].Parse<char>(2) << " ";
-	std::cout << AP["-I"].Parse<int>(3) << std::endl;
+	std::cout << AP["-I"].Value<int>(3) << std::endl;
 	
 	std::cout << "-J: " << AP["-J"].Parse<int>(0) << std::endl;
 	